@@ -3,10 +3,12 @@ function(build_pelec pelec_exe_name pelec_exe_options_file)
   unset(PELEC_EXTRA_SOURCES)
   unset(PELEC_DIM)
   unset(PELEC_ENABLE_EB)
+  unset(PELEC_ENABLE_EB_STENCIL_FLOAT)
   unset(PELEC_ENABLE_MASA)
   unset(PELEC_ENABLE_REACTIONS)
   unset(PELEC_ENABLE_MOL)
   unset(PELEC_ENABLE_PARTICLES)
+  unset(PELEC_ENABLE_UTIL_VODE)
   unset(PELEC_EOS_MODEL)
   unset(PELEC_REACTIONS_MODEL)
   unset(PELEC_CHEMISTRY_MODEL)
@@ -48,6 +50,10 @@ function(build_pelec pelec_exe_name pelec_exe_options_file)
     message(FATAL_ERROR "PELEC_ENABLE_EB does not work with PELEC_DIM=1")
   endif()
 
+  if(PELEC_NUM_SPECIES AND NOT PELEC_NUM_SPECIES MATCHES "^[1-9][0-9]*$")
+    message(FATAL_ERROR "PELEC_NUM_SPECIES must be a positive integer.")
+  endif()
+
   if("${PELEC_TRANSPORT_MODEL}" STREQUAL "EGLib")
     set(USE_FUEGO ON)
   endif()
@@ -102,6 +108,9 @@ function(build_pelec pelec_exe_name pelec_exe_options_file)
     target_compile_definitions(${pelec_exe_name} PRIVATE PELE_USE_EB)
     target_compile_definitions(${pelec_exe_name} PRIVATE PELEC_USE_EB)
     target_compile_definitions(${pelec_exe_name} PRIVATE AMREX_USE_EB)
+    if(PELEC_ENABLE_EB_STENCIL_FLOAT)
+      target_compile_definitions(${pelec_exe_name} PRIVATE PELEC_EB_STENCIL_FLOAT)
+    endif()
   endif()
 
   if("${PELEC_TRANSPORT_MODEL}" STREQUAL "EGLib")
@@ -120,9 +129,18 @@ function(build_pelec pelec_exe_name pelec_exe_options_file)
     target_compile_definitions(${pelec_exe_name} PRIVATE REACTIONS)
   endif()
 
+  if(PELEC_NUM_SPECIES)
+    target_compile_definitions(${pelec_exe_name} PRIVATE PELEC_NUM_SPECIES=${PELEC_NUM_SPECIES})
+  endif()
+
   if(PELEC_ENABLE_PARTICLES)
     target_compile_definitions(${pelec_exe_name} PRIVATE AMREX_PARTICLES)
   endif()
+
+  if(PELEC_ENABLE_UTIL_VODE)
+    target_compile_definitions(${pelec_exe_name} PRIVATE PELEC_USE_UTIL_VODE)
+    target_include_directories(${pelec_exe_name} PRIVATE ${CMAKE_SOURCE_DIR}/Util/VODE)
+  endif()
   
   #AMReX include directories
   target_include_directories(${pelec_exe_name} SYSTEM PRIVATE ${CMAKE_SOURCE_DIR}/Submodules/AMReX/Src/Base)
@@ -124,6 +124,7 @@ function(get_pelec_sources pelec_exe_name)
      ${PELEC_SOURCE_DIR}/problem_tagging_nd.F90
      ${PELEC_SOURCE_DIR}/rk_params.f90
      ${PELEC_SOURCE_DIR}/riemann_util.f90
+     ${PELEC_SOURCE_DIR}/species_count.F90
      ${PELEC_SOURCE_DIR}/string_mod.f90
      ${PELEC_SOURCE_DIR}/sums_nd.f90
      ${PELEC_SOURCE_DIR}/timestep.F90
@@ -134,6 +135,7 @@ function(get_pelec_sources pelec_exe_name)
   if(PELEC_ENABLE_REACTIONS)
      add_sources(GlobalSourceList
         ${PELEC_SOURCE_DIR}/React_nd.F90
+        ${PELEC_SOURCE_DIR}/react_cache.f90
      )
   endif()
   if(PELEC_ENABLE_MASA)
@@ -147,6 +149,42 @@ function(get_pelec_sources pelec_exe_name)
      ${PELEC_SOURCE_DIR}/constants_cgs.f90
   )
 
+  if(PELEC_ENABLE_UTIL_VODE)
+    set(PELEC_SOURCE_DIR "${CMAKE_SOURCE_DIR}/Util/VODE")
+    add_sources(GlobalSourceList
+       ${PELEC_SOURCE_DIR}/dvode.f
+       ${PELEC_SOURCE_DIR}/dvwarm.f
+       ${PELEC_SOURCE_DIR}/dvhin.f
+       ${PELEC_SOURCE_DIR}/dvindy.f
+       ${PELEC_SOURCE_DIR}/dvjac.f
+       ${PELEC_SOURCE_DIR}/dvjust.f
+       ${PELEC_SOURCE_DIR}/dvnlsd.f
+       ${PELEC_SOURCE_DIR}/dvnorm.f
+       ${PELEC_SOURCE_DIR}/dvset.f
+       ${PELEC_SOURCE_DIR}/dvsol.f
+       ${PELEC_SOURCE_DIR}/dvstep.f
+       ${PELEC_SOURCE_DIR}/xerrwd.f
+       ${PELEC_SOURCE_DIR}/dewset.f
+       ${PELEC_SOURCE_DIR}/ixsav.f
+       ${PELEC_SOURCE_DIR}/dumach.f
+       ${PELEC_SOURCE_DIR}/iumach.f
+       ${PELEC_SOURCE_DIR}/dacopy.f
+       ${PELEC_SOURCE_DIR}/dgbfa.f
+       ${PELEC_SOURCE_DIR}/dgbsl.f
+       ${PELEC_SOURCE_DIR}/dgefa.f
+       ${PELEC_SOURCE_DIR}/dgesl.f
+       ${PELEC_SOURCE_DIR}/dvsparse.f90
+    )
+    set(PELEC_SOURCE_DIR "${CMAKE_SOURCE_DIR}/Util/BLAS")
+    add_sources(GlobalSourceList
+       ${PELEC_SOURCE_DIR}/daxpy.f
+       ${PELEC_SOURCE_DIR}/dcopy.f
+       ${PELEC_SOURCE_DIR}/ddot.f
+       ${PELEC_SOURCE_DIR}/dscal.f
+       ${PELEC_SOURCE_DIR}/idamax.f
+    )
+  endif()
+
   #Add generated source files
   add_sources(GlobalSourceList
      ${CMAKE_BINARY_DIR}/generated_files/${pelec_exe_name}_generated_files/extern.f90
@@ -12,13 +12,18 @@ function(get_pelephysics_sources)
 
    set(PELEPHYSICS_SOURCE_DIR "${CMAKE_SOURCE_DIR}/Submodules/PelePhysics/Support/Fuego/Evaluation")
    add_sources(GlobalSourceList
-      ${PELEPHYSICS_SOURCE_DIR}/LinAlg.f
       ${PELEPHYSICS_SOURCE_DIR}/bdf.f90
       ${PELEPHYSICS_SOURCE_DIR}/bdf_data.f90
       ${PELEPHYSICS_SOURCE_DIR}/math_d.f
-      ${PELEPHYSICS_SOURCE_DIR}/vode.f
       ${PELEPHYSICS_SOURCE_DIR}/vode_module.f90
    )
+   # With PELEC_ENABLE_UTIL_VODE, DVODE and LINPACK/BLAS come from Util
+   if(NOT PELEC_ENABLE_UTIL_VODE)
+     add_sources(GlobalSourceList
+        ${PELEPHYSICS_SOURCE_DIR}/LinAlg.f
+        ${PELEPHYSICS_SOURCE_DIR}/vode.f
+     )
+   endif()
    if(USE_FUEGO)
      add_sources(GlobalSourceList
         ${PELEPHYSICS_SOURCE_DIR}/egz_module.f90
@@ -42,6 +42,10 @@ using std::string;
 #include <omp.h>
 #endif
 
+#if defined(REACTIONS) && defined(PELEC_USE_UTIL_VODE)
+#include "chemistry_file.H"
+#endif
+
 using namespace amrex;
 
 #ifdef USE_MASA
@@ -216,6 +220,7 @@ PeleC::variableCleanUp ()
 
 #ifdef PELE_USE_EB
   eb_initialized = false;
+  clear_eb_stencil_cache();
 #endif
 }
 
@@ -392,6 +397,18 @@ PeleC::read_params ()
   {
     amrex::Abort("Must do_mol_AD=1 when compiled with HYP_TYPE = MOL\n");
   }
+  if (mol_lsrk_order != 0 && mol_lsrk_order != 3 && mol_lsrk_order != 4)
+  {
+    amrex::Abort("pelec.mol_lsrk_order must be 0, 3 or 4\n");
+  }
+  if (mol_lsrk_order != 0 && mol_iters > 1)
+  {
+    amrex::Abort("pelec.mol_iters > 1 requires pelec.mol_lsrk_order = 0\n");
+  }
+  if (mol_pad_q && nscbc_diff == 1)
+  {
+    amrex::Abort("pelec.mol_pad_q = 1 is not supported with pelec.nscbc_diff = 1\n");
+  }
 #else
   if (do_mol_AD)
   {
@@ -399,6 +416,40 @@ PeleC::read_params ()
   }
 #endif
 
+#ifdef PELE_USE_EB
+  if (eb_stencil_cache && ParallelDescriptor::NProcs() > 1)
+  {
+    amrex::Print() << "WARNING: eb_stencil_cache is rank-local; only boxes that stay on the"
+                   << " same rank after a regrid reuse their EB structures" << std::endl;
+  }
+#endif
+
+  if (chem_batch_size < 1)
+  {
+    amrex::Abort("pelec.chem_batch_size must be at least 1\n");
+  }
+  if (chem_batch_size > 1 && react_warm_start)
+  {
+    amrex::Print() << "WARNING: react_warm_start is ignored by the batched chemistry"
+                   << " (chem_batch_size > 1)" << std::endl;
+  }
+#ifndef USE_SUNDIALS_PP
+  if (chem_batch_size > 1)
+  {
+    amrex::Abort("pelec.chem_batch_size > 1 requires USE_SUNDIALS_PP\n");
+  }
+#endif
+#ifndef PELEC_USE_UTIL_VODE
+  if (react_warm_start)
+  {
+    amrex::Abort("pelec.react_warm_start requires USE_UTIL_VODE\n");
+  }
+  if (chem_integrator == 3)
+  {
+    amrex::Abort("pelec.chem_integrator = 3 requires USE_UTIL_VODE\n");
+  }
+#endif
+
   if (do_les){
     pp.query("les_model",les_model);
     pp.query("les_test_filter_type",les_test_filter_type);
@@ -473,6 +524,21 @@ PeleC::read_params ()
   // This turns on the lb stuff inside Amr, but we use our own flag to signal whether to gather data
   ppa.query("loadbalance_with_workestimates",do_mol_load_balance);
   ppa.query("loadbalance_with_workestimates",do_react_load_balance);
+
+  // The chemistry layout of use_reactions_work_estimate is built from the
+  // work estimates, so they are gathered even if Amr does not balance with them
+  if (use_reactions_work_estimate) {
+    do_react_load_balance = true;
+  }
+
+  // Only level 0 has a split-phase Sborder fill; finer levels keep FillPatch
+  int amr_max_level = 0;
+  ppa.query("max_level",amr_max_level);
+  if (overlap_fill && amr_max_level > 0)
+  {
+    amrex::Print() << "WARNING: overlap_fill only overlaps the Sborder fill on level 0;"
+                   << " levels 1 and up use the blocking FillPatch" << std::endl;
+  }
 }
 
 PeleC::PeleC ()
@@ -859,6 +925,15 @@ PeleC::init (AmrLevel &old)
   {
     React_new.setVal(0);
   }
+
+  // Warm-start steps where the new grids overlap the old ones; the rest
+  // start cold
+  if (!oldlev->chem_dt.empty())
+  {
+    chem_dt.define(grids, dmap, 1, 0, MFInfo(), Factory());
+    chem_dt.setVal(0.0);
+    chem_dt.ParallelCopy(oldlev->chem_dt, 0, 0, 1);
+  }
 #endif
 
   if (do_mol_load_balance || do_react_load_balance)
@@ -1975,10 +2050,101 @@ PeleC::init_extern ()
 }
 
 #ifdef REACTIONS
+#ifdef PELEC_USE_UTIL_VODE
+//
+// Structure of the Jacobian of the vode reactor's system (species, then T),
+// column-major in pattern: species taking part in the same reaction are
+// coupled, T to everything; then whatever probing the production rates finds
+// (third-body efficiencies).  Checked against the analytic Jacobian at a few
+// states, since an entry missing from it would be dropped by the sparse LU.
+// Returns the order of the system.
+//
+static int
+chem_jacobian_structure (Vector<int>& pattern)
+{
+  int mm, kk, ii, nfit;
+  CKINDX(&mm, &kk, &ii, &nfit);
+  const int n = kk+1;
+
+  pattern.assign(n*n, 0);
+  for (int k = 0; k < n; ++k) {
+    pattern[k + n*kk] = 1;
+    pattern[kk + n*k] = 1;
+    pattern[k + n*k] = 1;
+  }
+
+  Vector<int> nuki(kk*ii);
+  CKNU(&kk, nuki.dataPtr());
+  for (int i = 0; i < ii; ++i) {
+    for (int k = 0; k < kk; ++k) {
+      if (nuki[k + kk*i] == 0) continue;
+      for (int j = 0; j < kk; ++j) {
+        if (nuki[j + kk*i] != 0) pattern[k + n*j] = 1;
+      }
+    }
+  }
+
+  pc_chem_jacobian_pattern(&n, pattern.dataPtr());
+
+  // Fixed pseudo-random states with every species present
+  const int nstates = 5;
+  unsigned int seed = 12345;
+  auto rand01 = [&seed] () {
+    seed = 1103515245u*seed + 12345u;
+    return static_cast<double>((seed >> 8) & 0xffffff)/16777216.0;
+  };
+  Vector<double> y(kk), c(kk), J(n*n);
+  int consP = 0;
+  for (int s = 0; s < nstates; ++s)
+  {
+    double rho = 1.e-3;
+    double T = 600.0 + 2400.0*rand01();
+    double ysum = 0.0;
+    for (int k = 0; k < kk; ++k) {
+      y[k] = 1.e-6 + rand01();
+      ysum += y[k];
+    }
+    for (int k = 0; k < kk; ++k) {
+      y[k] /= ysum;
+    }
+    CKYTCR(&rho, &T, y.dataPtr(), c.dataPtr());
+    DWDOT(J.dataPtr(), c.dataPtr(), &T, &consP);
+    for (int j = 0; j < n; ++j) {
+      for (int k = 0; k < n; ++k) {
+        if (J[k + n*j] != 0.0 && pattern[k + n*j] == 0) {
+          amrex::Abort("pelec.chem_integrator = 3: the Jacobian of the mechanism has entries "
+                       "outside the structure given to the sparse LU; use chem_integrator = 1\n");
+        }
+      }
+    }
+  }
+
+  return n;
+}
+#endif
+
 void
 PeleC::init_reactor ()
 {
-  pc_reactor_init();
+  pc_reactor_init(&chem_batch_size, &react_cache_size);
+
+#ifdef PELEC_USE_UTIL_VODE
+  if (chem_integrator == 3)
+  {
+    Vector<int> pattern;
+    const int n = chem_jacobian_structure(pattern);
+    int nnz_pattern, nnz_lu;
+    pc_vode_sparse_init(&n, pattern.dataPtr(), &nnz_pattern, &nnz_lu);
+    if (verbose) {
+      amrex::Print() << "... vode sparse LU: Jacobian entries " << nnz_pattern << ", LU entries "
+                     << nnz_lu << " of " << n*n << " (" << 100.0*nnz_lu/(n*n) << "%)" << std::endl;
+    }
+    if (n < 250) {
+      amrex::Print() << "WARNING: chem_integrator = 3 is not expected to beat the dense LU"
+                     << " below about 250 species; use chem_integrator = 1" << std::endl;
+    }
+  }
+#endif
 }
 
 void
@@ -1,5 +1,6 @@
 #include <PeleC.H>
 #include <PeleC_F.H>
+#include <TileScratch.H>
 
 using std::string;
 using namespace amrex;
@@ -19,7 +20,8 @@ PeleC::getMOLSrcTerm(const amrex::MultiFab& S,
                      amrex::MultiFab&       MOLSrcTerm,
                      amrex::Real            time,
                      amrex::Real            dt,
-                     amrex::Real            flux_factor) {
+                     amrex::Real            flux_factor,
+                     MOLTileSet             tile_set) {
   BL_PROFILE("PeleC::getMOLSrcTerm()");
   BL_PROFILE_VAR_NS("diffusion_stuff", diff);
   if (diffuse_temp == 0
@@ -75,6 +77,41 @@ PeleC::getMOLSrcTerm(const amrex::MultiFab& S,
      are needed to compute the barodiffusion and correction velocity expressions.
      Arithmetic averages are used there as well.  Thus, these face values are thermodynamically
      inconsistent.  Note sure what are the consequences of that.
+
+     C. With pelec.mol_fused_rhs = 1, regular tiles are instead handled by
+     getMOLSrcTermFusedTile, which runs steps 1-4 tile by tile, or sub-tile
+     by sub-tile with pelec.mol_fused_block_size > 0 so that the working set
+     stays in cache.  Its hyperbolic fluxes always come from
+     pc_hyp_mol_flux_regular (see G), in EB and non-EB builds alike.  The
+     path here is the reference.
+
+     D. With pelec.mol_cache_transport = 1, the transport coefficients of step 2
+     are kept per tile and only recomputed where the state (T, rho, Y) has moved
+     by more than pelec.mol_cache_transport_tol since they were evaluated, so
+     the corrector stage and further mol_iters typically reuse the predictor's.
+
+     E. Q is stored with components as the slowest index.  For the usual grown
+     tile sizes the component stride is a multiple of the page size, so all
+     the components of a cell share one L1 set, and loops touching more
+     components than the cache associativity (per-cell species gathers,
+     slopes over all of Q) thrash it.  pelec.mol_pad_q = 1 allocates Q and
+     Qaux over a box with odd lengths (see primitiveAllocBox); the kernels
+     only read Q over their own ranges, so they are unaffected by the extra
+     cells.  impose_NSCBC is the exception, since it finds the domain
+     boundaries from the bounds of Q, so read_params rejects mol_pad_q with
+     nscbc_diff.  Util/benchmarks/mol_q_layout.cpp measures the effect.
+
+     F. With tile_set, only the tiles whose grown box lies inside the valid
+     region of their grid (MOL_INTERIOR_TILES), or only the others
+     (MOL_HALO_TILES), are evaluated; see fillPatchedMOLSrcTerm.
+
+     G. In EB builds, a tile is regular when there are no cut cells within
+     ng-1 of it, so none of its fluxes are redistributed.  With
+     pelec.mol_regular_fast_path = 1 the hyperbolic fluxes of these tiles
+     come from pc_hyp_mol_flux_regular, which takes no EB data and only
+     works on a one-cell halo instead of the three of pc_hyp_mol_flux.  At
+     verbose > 1 the number of tiles of each type and the time spent on them
+     are reported.
   */
   int dComp_rhoD = 0;
   int dComp_rhoDaux = dComp_rhoD + NumSpec;
@@ -83,6 +120,15 @@ PeleC::getMOLSrcTerm(const amrex::MultiFab& S,
   int dComp_lambda = dComp_xi + 1;
   int nCompTr = dComp_lambda + 1;
   int do_harmonic = 1;  // TODO: parmparse this
+
+  // Diffusion classes that are switched off are never evaluated, and only
+  // the face coefficients read by the enabled ones are computed
+  int diffuse_ener = (diffuse_temp != 0 || diffuse_enth != 0) ? 1 : 0;
+  const bool do_diffusion = (diffuse_ener != 0 || diffuse_spec != 0 || diffuse_vel != 0
+                             || (NumAux > 0 && diffuse_aux != 0));
+  int dComp_ec = (diffuse_ener != 0 || diffuse_spec != 0) ? dComp_rhoD
+    : ((NumAux > 0 && diffuse_aux != 0) ? dComp_rhoDaux : dComp_mu);
+  int nComp_ec = nCompTr - dComp_ec;
   const Real* dx = geom.CellSize();
 
   Real dx1 = dx[0];
@@ -111,12 +157,38 @@ PeleC::getMOLSrcTerm(const amrex::MultiFab& S,
   int as_fine = (fr_as_fine != nullptr);
 #endif
 
+  // One transport cache entry per tile of S
+  if (mol_cache_transport) {
+    int ntiles = 0;
+    for (MFIter mfi(S, MFItInfo().EnableTiling(hydro_tile_size)); mfi.isValid(); ++mfi) {
+      ntiles = std::max(ntiles, mfi.LocalTileIndex() + 1);
+    }
+    if (static_cast<int>(transport_cache.size()) != ntiles) {
+      transport_cache.clear();
+      transport_cache.resize(ntiles);
+    }
+  }
+  long tr_cells_refreshed = 0;
+  long tr_cells_total = 0;
+#ifdef PELE_USE_EB
+  // Tiles of each type and the wall time spent on them
+  Real time_regular = 0, time_cut = 0, time_covered = 0;
+  long tiles_regular = 0, tiles_cut = 0, tiles_covered = 0;
+#endif
+
 #ifdef _OPENMP
-#pragma omp parallel
+#ifdef PELE_USE_EB
+#pragma omp parallel reduction(+:tr_cells_refreshed,tr_cells_total) \
+  reduction(+:time_regular,time_cut,time_covered,tiles_regular,tiles_cut,tiles_covered)
+#else
+#pragma omp parallel reduction(+:tr_cells_refreshed,tr_cells_total)
+#endif
 #endif
   {
+    // Tile temporaries alias the per-thread scratch arena, see TileScratch.H
+    TileScratch& scratch = TileScratch::get();
     FArrayBox Qfab, Qaux, coeff_cc, Dterm;
-    IArrayBox bcMask[BL_SPACEDIM];
+    BaseFab<int> bcMask[BL_SPACEDIM];
     FArrayBox coeff_ec[BL_SPACEDIM], flux_ec[BL_SPACEDIM],
       tander_ec[BL_SPACEDIM], flatn;
     FArrayBox dm_as_fine(Box::TheUnitBox(), NUM_STATE);
@@ -129,6 +201,25 @@ PeleC::getMOLSrcTerm(const amrex::MultiFab& S,
     FArrayBox hydro_source;
     FArrayBox filtered_hydro_flux[BL_SPACEDIM];
     FArrayBox filtered_hydro_source;
+#ifdef PELE_USE_EB
+    std::vector<Real> eb_flux_tile;
+
+    // Books the time since t0 to the tile type and returns it
+    auto tile_time = [&] (FabType t, Real t0) {
+      const Real elapsed = ParallelDescriptor::second() - t0;
+      if (t == FabType::regular) {
+        time_regular += elapsed;
+        ++tiles_regular;
+      } else if (t == FabType::covered) {
+        time_covered += elapsed;
+        ++tiles_covered;
+      } else {
+        time_cut += elapsed;
+        ++tiles_cut;
+      }
+      return elapsed;
+    };
+#endif
 
     int flag_nscbc_isAnyPerio = (geom.isAnyPeriodic()) ? 1 : 0; 
     int flag_nscbc_perio[BL_SPACEDIM]; // For 3D, we will know which corners have a periodicity
@@ -144,6 +235,7 @@ PeleC::getMOLSrcTerm(const amrex::MultiFab& S,
       Real wt = ParallelDescriptor::second();
 
 #endif
+      scratch.reset();
 
       const Box  vbox = mfi.tilebox();
       int ng = S.nGrow();
@@ -152,11 +244,13 @@ PeleC::getMOLSrcTerm(const amrex::MultiFab& S,
       const Box  cbox = amrex::grow(vbox,ng-1);
       const Box& dbox = geom.Domain();
 
-      // TODO: Add check that this is nextra-1
-      //       (better: fix bounds on ebflux computation in hyperbolic routine
-      //                to be a constant, and make sure this matches it)
-      const Box ebfluxbox = amrex::grow(vbox,2);
-      
+      if (tile_set != MOL_ALL_TILES) {
+        const bool interior = mfi.validbox().contains(gbox);
+        if (interior != (tile_set == MOL_INTERIOR_TILES)) {
+          continue;
+        }
+      }
+
       const int* lo = vbox.loVect();
 	  const int* hi = vbox.hiVect();
 
@@ -168,26 +262,76 @@ PeleC::getMOLSrcTerm(const amrex::MultiFab& S,
       if (typ == FabType::covered) {
         MOLSrcTerm[mfi].setVal(0, vbox, 0, NUM_STATE);
 
+        wt = tile_time(typ, wt);
         if (do_mol_load_balance) {
-          wt = (ParallelDescriptor::second() - wt) / vbox.d_numPts();
-
-          (*cost)[mfi].plus(wt, vbox);
+          (*cost)[mfi].plus(wt / vbox.d_numPts(), vbox);
         }
         continue;
       }
 
+      // The cut cells this tile can touch, contiguous (see EBTileSlice);
+      // their EB fluxes go to a tile-private buffer
       int local_i = mfi.LocalIndex();
-      int Ncut = no_eb_in_domain ? 0 : sv_eb_bndry_grad_stencil[local_i].size();
-      SparseData<amrex::Real,EBBndrySten> eb_flux_thdlocal;
-      eb_flux_thdlocal.define(sv_eb_bndry_grad_stencil[local_i], NUM_STATE);
+      int Ncut = 0;
+      const EBBndryGeom* ebg_tile = nullptr;
+      const EBBndrySten* sten_tile = nullptr;
+      const EBBndryStenC* sten_c_tile = nullptr;
+      const Real* bcval_tile = nullptr;
+      const EBStenReal* sten_c_coef = nullptr;
+      const signed char* sten_c_off = nullptr;
+      if (!no_eb_in_domain && !sv_eb_bndry_geom[local_i].empty()) {
+        const EBTileSlice& ts = sv_eb_tile_slice[mfi.LocalTileIndex()];
+        if (ts.whole) {
+          Ncut = sv_eb_bndry_geom[local_i].size();
+          ebg_tile = sv_eb_bndry_geom[local_i].data();
+          bcval_tile = sv_eb_bcval[local_i].dataPtr();
+          if (eb_compact_stencils) {
+            sten_c_tile = sv_eb_bndry_grad_stencil_c[local_i].sten.data();
+          } else {
+            sten_tile = sv_eb_bndry_grad_stencil[local_i].data();
+          }
+        } else {
+          Ncut = ts.geom.size();
+          ebg_tile = ts.geom.data();
+          bcval_tile = ts.bcval.data();
+          sten_tile = ts.sten.data();
+          sten_c_tile = ts.sten_c.data();
+        }
+        if (eb_compact_stencils) {
+          sten_c_coef = sv_eb_bndry_grad_stencil_c[local_i].coef.data();
+          sten_c_off  = sv_eb_bndry_grad_stencil_c[local_i].offset.data();
+        }
+      }
+      eb_flux_tile.assign(Ncut * NUM_STATE, 0);  // Default to Neumann for all fields
 #else
       const FArrayBox& Sfab = S[mfi];
 #endif
 
+      // Regular tiles may take the fused, cache-blocked path.  Cut-cell tiles,
+      // NSCBC and explicit filtering need the full-tile temporaries below.
+#ifdef PELE_USE_EB
+      if (mol_fused_rhs && typ == FabType::regular
+          && nscbc_diff == 0 && use_explicit_filter == 0)
+#else
+      if (mol_fused_rhs && nscbc_diff == 0 && use_explicit_filter == 0)
+#endif
+      {
+        getMOLSrcTermFusedTile(mfi, Sfab, MOLSrcTerm[mfi], ng,
+                               time, dt, flux_factor, dxDp,
+                               tr_cells_refreshed, tr_cells_total);
+#ifdef PELE_USE_EB
+        wt = tile_time(typ, wt);
+        if (do_mol_load_balance) {
+          (*cost)[mfi].plus(wt / vbox.d_numPts(), vbox);
+        }
+#endif
+        continue;
+      }
+
       BL_PROFILE_VAR_START(diff);
-      Qfab.resize(gbox, QVAR);
+      Qfab = scratch.fab(primitiveAllocBox(gbox), QVAR);
       int nqaux = NQAUX > 0 ? NQAUX : 1;
-      Qaux.resize(gbox, nqaux);
+      Qaux = scratch.fab(primitiveAllocBox(gbox), nqaux);
       // Get primitives, Q, including (Y, T, p, rho) from conserved state
       // required for D term
       {
@@ -207,7 +351,7 @@ PeleC::getMOLSrcTerm(const amrex::MultiFab& S,
           if (i!=d) TestBox.grow(d,1);
         }
         
-		    bcMask[i].resize(TestBox,1);
+		    bcMask[i] = scratch.ifab(TestBox,1);
         bcMask[i].setVal(0);
 	    }
       
@@ -232,53 +376,43 @@ PeleC::getMOLSrcTerm(const amrex::MultiFab& S,
       }
       
       // Compute transport coefficients, coincident with Q
-      {
-        BL_PROFILE("PeleC::get_transport_coeffs call");
-        coeff_cc.resize(gbox, nCompTr);
-        get_transport_coeffs(ARLIM_3D(gbox.loVect()),
-                             ARLIM_3D(gbox.hiVect()),
-                             BL_TO_FORTRAN_N_3D(Qfab, cQFS),
-                             BL_TO_FORTRAN_N_3D(Qfab, cQTEMP),
-                             BL_TO_FORTRAN_N_3D(Qfab, cQRHO),
-                             BL_TO_FORTRAN_N_3D(coeff_cc, dComp_rhoD),
-                             BL_TO_FORTRAN_N_3D(coeff_cc, dComp_mu),
-                             BL_TO_FORTRAN_N_3D(coeff_cc, dComp_xi),
-                             BL_TO_FORTRAN_N_3D(coeff_cc, dComp_lambda));
-      }
-      {
-        BL_PROFILE("PeleC::get_transport_coeffs_aux call");
-	if (NumAux > 0 && !(diffuse_aux == 0)) {
-        get_transport_coeffs_aux(ARLIM_3D(gbox.loVect()),
-                             ARLIM_3D(gbox.hiVect()),
-                             BL_TO_FORTRAN_N_3D(Qfab, cQFS),
-                             BL_TO_FORTRAN_N_3D(Qfab, cQTEMP),
-                             BL_TO_FORTRAN_N_3D(Qfab, cQRHO),
-                             BL_TO_FORTRAN_N_3D(coeff_cc, dComp_rhoDaux));
-	}
+      if (do_diffusion) {
+        if (mol_cache_transport) {
+          bool force_refresh;
+          TransportCacheEntry& tr = transportCacheEntry(mfi, gbox, force_refresh);
+          if (refreshTransportCache(tr, force_refresh, gbox, Qfab)) {
+            tr_cells_refreshed += gbox.numPts();
+          }
+          tr_cells_total += gbox.numPts();
+          coeff_cc = FArrayBox(gbox, nCompTr, tr.coeff.dataPtr());
+        } else {
+          coeff_cc = scratch.fab(gbox, nCompTr);
+          getTransportCoeffs(gbox, Qfab, coeff_cc);
+        }
       }
 
       // Container on grown region, for hybrid divergence & redistribution
-      Dterm.resize(cbox, NUM_STATE);
+      Dterm = scratch.fab(cbox, NUM_STATE);
 
       for (int d=0; d<BL_SPACEDIM; ++d) {
         Box ebox = amrex::surroundingNodes(cbox,d);
-        coeff_ec[d].resize(ebox,nCompTr);
-        flux_ec[d].resize(ebox,NUM_STATE);
+        coeff_ec[d] = scratch.fab(ebox,nCompTr);
+        flux_ec[d] = scratch.fab(ebox,NUM_STATE);
         flux_ec[d].setVal(0);
         // Get face-centered transport coefficients
-        {
+        if (do_diffusion) {
           BL_PROFILE("PeleC::pc_move_transport_coeffs_to_ec call");
           pc_move_transport_coeffs_to_ec(ARLIM_3D(cbox.loVect()),
                                          ARLIM_3D(cbox.hiVect()),
                                          ARLIM_3D(dbox.loVect()),
                                          ARLIM_3D(dbox.hiVect()),
-                                         BL_TO_FORTRAN_3D(coeff_cc),
-                                         BL_TO_FORTRAN_3D(coeff_ec[d]),
-                                         &d, &nCompTr, &do_harmonic);
+                                         BL_TO_FORTRAN_N_3D(coeff_cc, dComp_ec),
+                                         BL_TO_FORTRAN_N_3D(coeff_ec[d], dComp_ec),
+                                         &d, &nComp_ec, &do_harmonic);
         }
 #if (BL_SPACEDIM > 1)
         int nCompTan = AMREX_D_PICK(1, 2, 6);
-        tander_ec[d].resize(ebox, nCompTan); tander_ec[d].setVal(0);
+        tander_ec[d] = scratch.fab(ebox, nCompTan); tander_ec[d].setVal(0);
         // Tangential derivatives on faces only needed for velocity diffusion
         if (diffuse_vel == 0) {
           tander_ec[d].setVal(0);
@@ -302,7 +436,7 @@ PeleC::getMOLSrcTerm(const amrex::MultiFab& S,
                                                   cbox.hiVect(),
                                                   dbox.loVect(),
                                                   dbox.hiVect(),
-                                                  sv_eb_bndry_geom[mfi.LocalIndex()].data(),
+                                                  ebg_tile,
                                                   &Ncut,
                                                   BL_TO_FORTRAN_ANYD(Qfab),
                                                   BL_TO_FORTRAN_ANYD(tander_ec[d]),
@@ -318,7 +452,9 @@ PeleC::getMOLSrcTerm(const amrex::MultiFab& S,
       }  // loop over dimension
 
       // Compute extensive diffusion fluxes, F.A and (1/Vol).Div(F.A)
-      {
+      if (!do_diffusion) {
+        Dterm.setVal(0);
+      } else {
         BL_PROFILE("PeleC::pc_diffterm()");
         pc_diffterm(cbox.loVect(),
                     cbox.hiVect(),
@@ -354,7 +490,8 @@ PeleC::getMOLSrcTerm(const amrex::MultiFab& S,
 #endif
                     BL_TO_FORTRAN_ANYD(volume[mfi]),
                     BL_TO_FORTRAN_ANYD(Dterm),
-                    geom.CellSize());
+                    geom.CellSize(),
+                    &diffuse_vel, &diffuse_spec, &diffuse_ener);
       }
 
       // Diffusion fluxes for auxiliary variables
@@ -377,13 +514,10 @@ PeleC::getMOLSrcTerm(const amrex::MultiFab& S,
 	  }
        }   
 
-      // Shut off unwanted diffusion after the fact
-      //    ick! Under normal conditions, you either have diffusion on all or
-      //      none, so this shouldn't be done this way.  However, the regression
-      //      test for diffusion works by diffusing only temperature through
-      //      this process.  Ideally, we'd redo that test to diffuse a passive
-      //      scalar instead....
-          
+      // pc_diffterm skips the work of disabled diffusion classes, but may
+      // still leave by-products in their components (e.g., the momentum
+      // fluxes it needs for the viscous work in the energy flux), so clear
+      // them here
       if (diffuse_temp == 0 && diffuse_enth == 0) {
         Dterm.setVal(0, Eden);
         Dterm.setVal(0, Eint);
@@ -410,14 +544,8 @@ PeleC::getMOLSrcTerm(const amrex::MultiFab& S,
       //  non-zero only for heat flux on isothermal boundaries,
       //  and momentum fluxes at no-slip walls
       if (typ == FabType::singlevalued && Ncut > 0) {
-        eb_flux_thdlocal.setVal(0);  // Default to Neumann for all fields
-
-        int Nvals = sv_eb_bcval[local_i].numPts();
-        int Nflux = sv_eb_flux[local_i].numPts();
-
-        BL_ASSERT(Nvals == Ncut);
-        BL_ASSERT(Nflux == Ncut);
-
+        int Nvals = Ncut;
+        int Nflux = Ncut;
         if (eb_isothermal && (diffuse_temp != 0 || diffuse_enth != 0)) {
           // Compute heat flux at EB wall
           int nComp = 1;
@@ -425,15 +553,28 @@ PeleC::getMOLSrcTerm(const amrex::MultiFab& S,
           Box box_to_apply = mfi.growntilebox(2);
           {
             BL_PROFILE("PeleC::pc_apply_eb_boundry_flux_stencil call");
-            pc_apply_eb_boundry_flux_stencil(BL_TO_FORTRAN_BOX(box_to_apply),
-                                             sv_eb_bndry_grad_stencil[local_i].data(),
-                                             &Ncut,
-                                             BL_TO_FORTRAN_N_ANYD(Qfab, cQTEMP),
-                                             BL_TO_FORTRAN_N_ANYD(coeff_cc, dComp_lambda),
-                                             sv_eb_bcval[local_i].dataPtr(cQTEMP),
-                                             &Nvals,
-                                             eb_flux_thdlocal.dataPtr(Eden),
-                                             &Nflux, &nComp);
+            if (eb_compact_stencils) {
+              pc_apply_eb_boundry_flux_stencil_c(BL_TO_FORTRAN_BOX(box_to_apply),
+                                                 sten_c_tile,
+                                                 &Ncut,
+                                                 sten_c_coef, sten_c_off,
+                                                 BL_TO_FORTRAN_N_ANYD(Qfab, cQTEMP),
+                                                 BL_TO_FORTRAN_N_ANYD(coeff_cc, dComp_lambda),
+                                                 bcval_tile + cQTEMP * Ncut,
+                                                 &Nvals,
+                                                 eb_flux_tile.data() + Eden * Ncut,
+                                                 &Nflux, &nComp);
+            } else {
+              pc_apply_eb_boundry_flux_stencil(BL_TO_FORTRAN_BOX(box_to_apply),
+                                               sten_tile,
+                                               &Ncut,
+                                               BL_TO_FORTRAN_N_ANYD(Qfab, cQTEMP),
+                                               BL_TO_FORTRAN_N_ANYD(coeff_cc, dComp_lambda),
+                                               bcval_tile + cQTEMP * Ncut,
+                                               &Nvals,
+                                               eb_flux_tile.data() + Eden * Ncut,
+                                               &Nflux, &nComp);
+            }
           }
         }
         // Compute momentum transfer at no-slip EB wall
@@ -443,16 +584,30 @@ PeleC::getMOLSrcTerm(const amrex::MultiFab& S,
           Box box_to_apply = mfi.growntilebox(2);
           {
             BL_PROFILE("PeleC::pc_apply_eb_boundry_visc_flux_stencil call");
-            pc_apply_eb_boundry_visc_flux_stencil(BL_TO_FORTRAN_BOX(box_to_apply),
-                                                  sv_eb_bndry_grad_stencil[local_i].data(),
-                                                  &Ncut,
-                                                  sv_eb_bndry_geom[local_i].data(), &Ncut,
-                                                  BL_TO_FORTRAN_N_ANYD(Qfab, cQU),
-                                                  BL_TO_FORTRAN_N_ANYD(coeff_cc, dComp_mu),
-                                                  BL_TO_FORTRAN_N_ANYD(coeff_cc, dComp_xi),
-                                                  sv_eb_bcval[local_i].dataPtr(cQU), &Nvals,
-                                                  eb_flux_thdlocal.dataPtr(Xmom), &Nflux,
-                                                  &nComp);
+            if (eb_compact_stencils) {
+              pc_apply_eb_boundry_visc_flux_stencil_c(BL_TO_FORTRAN_BOX(box_to_apply),
+                                                      sten_c_tile,
+                                                      &Ncut,
+                                                      sten_c_coef, sten_c_off,
+                                                      ebg_tile, &Ncut,
+                                                      BL_TO_FORTRAN_N_ANYD(Qfab, cQU),
+                                                      BL_TO_FORTRAN_N_ANYD(coeff_cc, dComp_mu),
+                                                      BL_TO_FORTRAN_N_ANYD(coeff_cc, dComp_xi),
+                                                      bcval_tile + cQU * Ncut, &Nvals,
+                                                      eb_flux_tile.data() + Xmom * Ncut, &Nflux,
+                                                      &nComp);
+            } else {
+              pc_apply_eb_boundry_visc_flux_stencil(BL_TO_FORTRAN_BOX(box_to_apply),
+                                                    sten_tile,
+                                                    &Ncut,
+                                                    ebg_tile, &Ncut,
+                                                    BL_TO_FORTRAN_N_ANYD(Qfab, cQU),
+                                                    BL_TO_FORTRAN_N_ANYD(coeff_cc, dComp_mu),
+                                                    BL_TO_FORTRAN_N_ANYD(coeff_cc, dComp_xi),
+                                                    bcval_tile + cQU * Ncut, &Nvals,
+                                                    eb_flux_tile.data() + Xmom * Ncut, &Nflux,
+                                                    &nComp);
+            }
           }
         }
       }
@@ -463,7 +618,7 @@ PeleC::getMOLSrcTerm(const amrex::MultiFab& S,
 #ifdef PELEC_USE_MOL
       /* At this point flux_ec contains the diffusive fluxes in each direction
          at face centers for the (potentially partially covered) grid-aligned 
-         faces and eb_flux_thdlocal contains the flux for the cut faces. Before
+         faces and eb_flux_tile contains the flux for the cut faces. Before
          computing hybrid divergence, comptue and add in the hydro fluxes. 
          Also, Dterm currently contains the divergence of the face-centered
          diffusion fluxes.  Increment this with the divergence of the
@@ -471,52 +626,81 @@ PeleC::getMOLSrcTerm(const amrex::MultiFab& S,
       */
       if (do_hydro && do_mol_AD)
       {
-        flatn.resize(cbox,1);
+        flatn = scratch.fab(cbox,1);
         flatn.setVal(1.0);  // Set flattening to 1.0
 #ifdef PELEC_USE_EB
-        int nFlux = sv_eb_flux.size()==0 ? 0 : sv_eb_flux[local_i].numPts();
-        const EBBndryGeom* sv_ebbg_ptr = (Ncut>0 ? sv_eb_bndry_geom[local_i].data() : 0);
-        Real* sv_eb_flux_ptr = (nFlux>0 ? eb_flux_thdlocal.dataPtr() : 0);
+        int nFlux = Ncut;
+        const EBBndryGeom* sv_ebbg_ptr = (Ncut>0 ? ebg_tile : 0);
+        Real* sv_eb_flux_ptr = (nFlux>0 ? eb_flux_tile.data() : 0);
+
+        // Without cut cells in reach and with nothing filtered, only the
+        // fluxes on the faces of vbox are needed
+        const bool regular_hyp = (mol_regular_fast_path && typ == FabType::regular
+                                  && use_explicit_filter == 0);
+#else
+        const bool regular_hyp = false;
 #endif
 
         // save off the diffusion source term and fluxes (don't want to filter these)
         if (use_explicit_filter)
         {
           for (int i = 0; i < BL_SPACEDIM ; i++){
-            diffusion_flux[i].resize(flux_ec[i].box(), NUM_STATE);
+            diffusion_flux[i] = scratch.fab(flux_ec[i].box(), NUM_STATE);
             diffusion_flux[i].copy(flux_ec[i], Density, Density, NUM_STATE);
           }
-          diffusion_source.resize(Dterm.box(),NUM_STATE);
+          diffusion_source = scratch.fab(Dterm.box(),NUM_STATE);
           diffusion_source.copy(Dterm, Density, Density, NUM_STATE);
         }
 
         { // Get face-centered hyperbolic fluxes and their divergences.
           // Get hyp flux at EB wall
-          BL_PROFILE("PeleC::pc_hyp_mol_flux call");
-          pc_hyp_mol_flux(vbox.loVect(), vbox.hiVect(),
-                          geom.Domain().loVect(), geom.Domain().hiVect(),
-                          BL_TO_FORTRAN_3D(Qfab),
-                          BL_TO_FORTRAN_3D(Qaux),
-                          BL_TO_FORTRAN_ANYD(area[0][mfi]),
-                          BL_TO_FORTRAN_3D(flux_ec[0]),
+          if (regular_hyp) {
+            BL_PROFILE("PeleC::pc_hyp_mol_flux_regular call");
+            pc_hyp_mol_flux_regular(vbox.loVect(), vbox.hiVect(),
+                                    geom.Domain().loVect(), geom.Domain().hiVect(),
+                                    BL_TO_FORTRAN_3D(Qfab),
+                                    BL_TO_FORTRAN_3D(Qaux),
+                                    BL_TO_FORTRAN_ANYD(area[0][mfi]),
+                                    BL_TO_FORTRAN_3D(flux_ec[0]),
 #if (BL_SPACEDIM > 1)
-                          BL_TO_FORTRAN_ANYD(area[1][mfi]),
-                          BL_TO_FORTRAN_3D(flux_ec[1]),
+                                    BL_TO_FORTRAN_ANYD(area[1][mfi]),
+                                    BL_TO_FORTRAN_3D(flux_ec[1]),
 #if (BL_SPACEDIM > 2)
-                          BL_TO_FORTRAN_ANYD(area[2][mfi]),
-                          BL_TO_FORTRAN_3D(flux_ec[2]),
+                                    BL_TO_FORTRAN_ANYD(area[2][mfi]),
+                                    BL_TO_FORTRAN_3D(flux_ec[2]),
+#endif
 #endif
+                                    BL_TO_FORTRAN_3D(flatn),
+                                    BL_TO_FORTRAN_ANYD(volume[mfi]),
+                                    BL_TO_FORTRAN_3D(Dterm),
+                                    geom.CellSize());
+          } else {
+            BL_PROFILE("PeleC::pc_hyp_mol_flux call");
+            pc_hyp_mol_flux(vbox.loVect(), vbox.hiVect(),
+                            geom.Domain().loVect(), geom.Domain().hiVect(),
+                            BL_TO_FORTRAN_3D(Qfab),
+                            BL_TO_FORTRAN_3D(Qaux),
+                            BL_TO_FORTRAN_ANYD(area[0][mfi]),
+                            BL_TO_FORTRAN_3D(flux_ec[0]),
+#if (BL_SPACEDIM > 1)
+                            BL_TO_FORTRAN_ANYD(area[1][mfi]),
+                            BL_TO_FORTRAN_3D(flux_ec[1]),
+#if (BL_SPACEDIM > 2)
+                            BL_TO_FORTRAN_ANYD(area[2][mfi]),
+                            BL_TO_FORTRAN_3D(flux_ec[2]),
 #endif
-                          BL_TO_FORTRAN_3D(flatn),
-                          BL_TO_FORTRAN_ANYD(volume[mfi]),
-                          BL_TO_FORTRAN_3D(Dterm),
+#endif
+                            BL_TO_FORTRAN_3D(flatn),
+                            BL_TO_FORTRAN_ANYD(volume[mfi]),
+                            BL_TO_FORTRAN_3D(Dterm),
 #ifdef PELEC_USE_EB
-                          BL_TO_FORTRAN_ANYD(vfrac[mfi]),
-                          BL_TO_FORTRAN_ANYD(flag_fab),
-                          sv_ebbg_ptr, &Ncut,
-                          sv_eb_flux_ptr, &nFlux,
+                            BL_TO_FORTRAN_ANYD(vfrac[mfi]),
+                            BL_TO_FORTRAN_ANYD(flag_fab),
+                            sv_ebbg_ptr, &Ncut,
+                            sv_eb_flux_ptr, &nFlux,
 #endif
-                          geom.CellSize());
+                            geom.CellSize());
+          }
         }
 
         // Filter hydro source term and fluxes here
@@ -524,23 +708,23 @@ PeleC::getMOLSrcTerm(const amrex::MultiFab& S,
         {
           // Get the hydro term
           for (int i = 0; i < BL_SPACEDIM ; i++){
-            hydro_flux[i].resize(flux_ec[i].box(), NUM_STATE);
+            hydro_flux[i] = scratch.fab(flux_ec[i].box(), NUM_STATE);
             hydro_flux[i].linComb(flux_ec[i],flux_ec[i].box(),Density,diffusion_flux[i],diffusion_flux[i].box(),Density,1.0,-1.0,hydro_flux[i].box(),Density,NUM_STATE);
           }
-          hydro_source.resize(Dterm.box(),NUM_STATE);
+          hydro_source = scratch.fab(Dterm.box(),NUM_STATE);
           hydro_source.linComb(Dterm,Dterm.box(),Density,diffusion_source,diffusion_source.box(),Density,1.0,-1.0,hydro_source.box(),Density,NUM_STATE);
 
           // Filter
           const Box  fbox = amrex::grow(vbox,ng-1-nGrowF);
           for (int i = 0; i < BL_SPACEDIM ; i++)  {
             const Box& bxtmp = amrex::surroundingNodes(fbox,i);
-            filtered_hydro_flux[i].resize(bxtmp, NUM_STATE);
+            filtered_hydro_flux[i] = scratch.fab(bxtmp, NUM_STATE);
             les_filter.apply_filter(bxtmp, hydro_flux[i], filtered_hydro_flux[i], Density, NUM_STATE);
 
             hydro_flux[i].setVal(0);
             hydro_flux[i].copy(filtered_hydro_flux[i], Density, Density, NUM_STATE);
           }
-          filtered_hydro_source.resize(fbox, NUM_STATE);
+          filtered_hydro_source = scratch.fab(fbox, NUM_STATE);
           les_filter.apply_filter(fbox, hydro_source, filtered_hydro_source, Density, NUM_STATE);
           hydro_source.setVal(0);
           hydro_source.copy(filtered_hydro_source, Density, Density, NUM_STATE);
@@ -555,19 +739,6 @@ PeleC::getMOLSrcTerm(const amrex::MultiFab& S,
 #endif
 
 #ifdef PELEC_USE_EB
-      std::vector<int> eb_tile_mask;
-      eb_tile_mask.resize(Ncut);
-      for (int icut = 0; icut < Ncut; ++icut){
-          if (ebfluxbox.contains(sv_eb_bndry_geom[local_i][icut].iv)) {
-              eb_tile_mask[icut] = 1;
-          } else {
-              eb_tile_mask[icut] = 0;
-          }
-      }
-      if (typ == FabType::singlevalued) {
-          sv_eb_flux[local_i].merge(eb_flux_thdlocal,0, NUM_STATE, eb_tile_mask);
-      }
-
       if (typ == FabType::singlevalued) {
         /* Interpolate fluxes from face centers to face centroids
          * Note that hybrid divergence and redistribution algorithms require that we
@@ -577,11 +748,21 @@ PeleC::getMOLSrcTerm(const amrex::MultiFab& S,
          */
 
         for (int idir=0; idir < BL_SPACEDIM; ++idir) {
-          int Nsten = flux_interp_stencil[idir][local_i].size();
           int in_place = 1;
           const Box valid_interped_flux_box =
             Box(amrex::grow(vbox, 2)).surroundingNodes(idir);
-          {
+          if (eb_compact_stencils) {
+            const auto& sc = flux_interp_stencil_c[idir][local_i];
+            int Nsten = sc.sten.size();
+            BL_PROFILE("PeleC::pc_apply_face_stencil call");
+            pc_apply_face_stencil_c(BL_TO_FORTRAN_BOX(valid_interped_flux_box),
+                                    sc.sten.data(), &Nsten,
+                                    sc.coef.data(), sc.offset.data(),
+                                    BL_TO_FORTRAN_ANYD(flux_ec[idir]),
+                                    BL_TO_FORTRAN_ANYD(flux_ec[idir]),
+                                    &NUM_STATE, &in_place);
+          } else {
+            int Nsten = flux_interp_stencil[idir][local_i].size();
             BL_PROFILE("PeleC::pc_apply_face_stencil call");
             pc_apply_face_stencil(BL_TO_FORTRAN_BOX(valid_interped_flux_box),
                                   BL_TO_FORTRAN_BOX(stencil_volume_box),
@@ -613,7 +794,7 @@ PeleC::getMOLSrcTerm(const amrex::MultiFab& S,
         const FArrayBox& W = vfrac[mfi];
         int wComp = 0;
 
-        int Nflux = sv_eb_flux[local_i].numPts();
+        int Nflux = Ncut;
         {
           FArrayBox* p_drho_as_crse = (fr_as_crse) ?
             fr_as_crse->getCrseData(mfi) : &fab_drho_as_crse;
@@ -621,16 +802,16 @@ PeleC::getMOLSrcTerm(const amrex::MultiFab& S,
             fr_as_crse->getCrseFlag(mfi) : &fab_rrflag_as_crse;
 
           if (fr_as_fine) {
-            dm_as_fine.resize(amrex::grow(vbox, 1), NUM_STATE);
+            dm_as_fine = scratch.fab(amrex::grow(vbox, 1), NUM_STATE);
           }
           BL_PROFILE("PeleC::pc_fix_div_and_redistribute call");
           pc_fix_div_and_redistribute(BL_TO_FORTRAN_BOX(vbox),
-                                      sv_eb_bndry_geom[local_i].data(), &Ncut,
+                                      ebg_tile, &Ncut,
                                       BL_TO_FORTRAN_ANYD(flag_fab),
                                       D_DECL(BL_TO_FORTRAN_ANYD(flux_ec[0]),
                                              BL_TO_FORTRAN_ANYD(flux_ec[1]),
                                              BL_TO_FORTRAN_ANYD(flux_ec[2])),
-                                      sv_eb_flux[local_i].dataPtr(), &Nflux,
+                                      eb_flux_tile.data(), &Nflux,
                                       BL_TO_FORTRAN_ANYD(Dterm),
                                       BL_TO_FORTRAN_N_ANYD(W, wComp),
                                       BL_TO_FORTRAN_ANYD(vfrac[mfi]),
@@ -708,16 +889,36 @@ PeleC::getMOLSrcTerm(const amrex::MultiFab& S,
         }
 
 #ifdef PELEC_USE_EB
+      wt = tile_time(typ, wt);
       if (do_mol_load_balance) {
-        wt = (ParallelDescriptor::second() - wt) / vbox.d_numPts();
-        (*cost)[mfi].plus(wt, vbox);
+        (*cost)[mfi].plus(wt / vbox.d_numPts(), vbox);
       }
 #endif
     }  // End of MFIter scope
   }  // End of OMP scope
 
-  // Extrapolate to ghost cells
-  if (MOLSrcTerm.nGrow() > 0) {
+  if (mol_cache_transport && verbose > 1) {
+    long tr_cells[2] = {tr_cells_refreshed, tr_cells_total};
+    ParallelDescriptor::ReduceLongSum(tr_cells, 2, ParallelDescriptor::IOProcessorNumber());
+    amrex::Print() << "PeleC::getMOLSrcTerm(): level " << level << " transport coefficients refreshed on "
+                   << tr_cells[0] << " of " << tr_cells[1] << " cells" << std::endl;
+  }
+
+#ifdef PELE_USE_EB
+  if (verbose > 1) {
+    long tiles[3] = {tiles_regular, tiles_cut, tiles_covered};
+    Real tile_secs[3] = {time_regular, time_cut, time_covered};
+    ParallelDescriptor::ReduceLongSum(tiles, 3, ParallelDescriptor::IOProcessorNumber());
+    ParallelDescriptor::ReduceRealSum(tile_secs, 3, ParallelDescriptor::IOProcessorNumber());
+    amrex::Print() << "PeleC::getMOLSrcTerm(): level " << level
+                   << " regular/cut/covered tiles " << tiles[0] << "/" << tiles[1] << "/" << tiles[2]
+                   << ", time " << tile_secs[0] << "/" << tile_secs[1] << "/" << tile_secs[2]
+                   << " s" << std::endl;
+  }
+#endif
+
+  // Extrapolate to ghost cells, once all tiles are done
+  if (MOLSrcTerm.nGrow() > 0 && tile_set != MOL_INTERIOR_TILES) {
 #ifdef _OPENMP
 #pragma omp parallel
 #endif
@@ -741,3 +942,415 @@ PeleC::getMOLSrcTerm(const amrex::MultiFab& S,
     }
   }
 }
+
+// **********************************************************************************************
+void
+PeleC::fillPatchedMOLSrcTerm(amrex::Real      fill_time,
+                             amrex::MultiFab& MOLSrcTerm,
+                             amrex::Real      time,
+                             amrex::Real      dt,
+                             amrex::Real      flux_factor) {
+  BL_PROFILE("PeleC::fillPatchedMOLSrcTerm()");
+  /**
+     With overlap_fill on level 0, the tiles that read no ghost cells are
+     evaluated while the exchange of Sborder is in flight, and the remaining
+     tiles once it has completed (see startSborderFill).  The result is
+     identical to FillPatch + getMOLSrcTerm.
+  */
+  if (!overlap_fill || level > 0) {
+    const Real t0 = ParallelDescriptor::second();
+    FillPatch(*this, Sborder, nGrowTr, fill_time, State_Type, 0, NUM_STATE);
+    sborder_fill_blocking += ParallelDescriptor::second() - t0;
+    getMOLSrcTerm(Sborder, MOLSrcTerm, time, dt, flux_factor);
+    return;
+  }
+
+  startSborderFill(fill_time);
+  getMOLSrcTerm(Sborder, MOLSrcTerm, time, dt, flux_factor, MOL_INTERIOR_TILES);
+  finishSborderFill(fill_time);
+  getMOLSrcTerm(Sborder, MOLSrcTerm, time, dt, flux_factor, MOL_HALO_TILES);
+}
+
+// **********************************************************************************************
+void
+PeleC::getMOLSrcTermFusedTile(const amrex::MFIter&    mfi,
+                              const amrex::FArrayBox& Sfab,
+                              amrex::FArrayBox&       MOLSrc,
+                              int                     ng,
+                              amrex::Real             time,
+                              amrex::Real             dt,
+                              amrex::Real             flux_factor,
+                              const amrex::Real*      dxDp,
+                              long&                   tr_cells_refreshed,
+                              long&                   tr_cells_total) {
+  BL_PROFILE("PeleC::getMOLSrcTermFusedTile()");
+  /**
+     Same operator as the regular-tile branch of getMOLSrcTerm, but with
+     mol_fused_block_size > 0 the tile is chopped into pencils (full extent in
+     x, mol_fused_block_size in y and z), and primitives, transport
+     coefficients, diffusive and hyperbolic fluxes are all evaluated on one
+     pencil before moving on to the next.  Every pencil pays for its own
+     halo, see the parameter's doc.  Since no
+     redistribution is needed on a regular tile, the diffusion operator is
+     only evaluated over the valid pencil, not the grown one.
+   */
+  int dComp_rhoD = 0;
+  int dComp_rhoDaux = dComp_rhoD + NumSpec;
+  int dComp_mu = dComp_rhoDaux + NumAux;
+  int dComp_xi = dComp_mu + 1;
+  int dComp_lambda = dComp_xi + 1;
+  int nCompTr = dComp_lambda + 1;
+  int do_harmonic = 1;
+
+  int diffuse_ener = (diffuse_temp != 0 || diffuse_enth != 0) ? 1 : 0;
+  const bool do_diffusion = (diffuse_ener != 0 || diffuse_spec != 0 || diffuse_vel != 0
+                             || (NumAux > 0 && diffuse_aux != 0));
+  int dComp_ec = (diffuse_ener != 0 || diffuse_spec != 0) ? dComp_rhoD
+    : ((NumAux > 0 && diffuse_aux != 0) ? dComp_rhoDaux : dComp_mu);
+  int nComp_ec = nCompTr - dComp_ec;
+
+  const Box  vbox = mfi.tilebox();
+  const Box& dbox = geom.Domain();
+  const bool do_flux_reg = (do_reflux && flux_factor != 0);
+
+  TileScratch& scratch = TileScratch::get();
+  FArrayBox Qfab, Qaux, coeff_cc, Dterm, flatn;
+  FArrayBox coeff_ec[BL_SPACEDIM], flux_ec[BL_SPACEDIM], tander_ec[BL_SPACEDIM];
+  FArrayBox flux_tile[BL_SPACEDIM];
+
+  if (do_flux_reg) {
+    for (int d=0; d<BL_SPACEDIM; ++d) {
+      flux_tile[d] = scratch.fab(amrex::surroundingNodes(vbox,d), NUM_STATE);
+    }
+  }
+
+  IntVect block_size(vbox.size());
+  if (mol_fused_block_size > 0) {
+    for (int d=1; d<BL_SPACEDIM; ++d) {
+      block_size[d] = mol_fused_block_size;
+    }
+  }
+  BoxList blocks(vbox);
+  blocks.maxSize(block_size);
+
+  // The cache entry spans the whole grown tile; each pencil checks and
+  // refreshes its own part of it
+  bool force_refresh = false;
+  TransportCacheEntry* tr = nullptr;
+  if (mol_cache_transport && do_diffusion) {
+    tr = &transportCacheEntry(mfi, amrex::grow(vbox,ng), force_refresh);
+  }
+
+  // Pencil temporaries are released after each pencil
+  const std::size_t tile_mark = scratch.mark();
+
+  for (const Box& bbox : blocks) {
+    scratch.rewind(tile_mark);
+    const Box gbox = amrex::grow(bbox,ng);
+    const Box cbox = amrex::grow(bbox,ng-1);
+
+    Qfab = scratch.fab(primitiveAllocBox(gbox), QVAR);
+    int nqaux = NQAUX > 0 ? NQAUX : 1;
+    Qaux = scratch.fab(primitiveAllocBox(gbox), nqaux);
+    {
+      BL_PROFILE("PeleC::ctoprim call");
+      ctoprim(ARLIM_3D(gbox.loVect()), ARLIM_3D(gbox.hiVect()),
+              Sfab.dataPtr(), ARLIM_3D(Sfab.loVect()), ARLIM_3D(Sfab.hiVect()),
+              Qfab.dataPtr(), ARLIM_3D(Qfab.loVect()), ARLIM_3D(Qfab.hiVect()),
+              Qaux.dataPtr(), ARLIM_3D(Qaux.loVect()), ARLIM_3D(Qaux.hiVect()));
+    }
+
+    if (tr != nullptr) {
+      if (refreshTransportCache(*tr, force_refresh, gbox, Qfab)) {
+        tr_cells_refreshed += gbox.numPts();
+      }
+      tr_cells_total += gbox.numPts();
+      coeff_cc = FArrayBox(tr->coeff.box(), nCompTr, tr->coeff.dataPtr());
+    } else if (do_diffusion) {
+      coeff_cc = scratch.fab(gbox, nCompTr);
+      getTransportCoeffs(gbox, Qfab, coeff_cc);
+    }
+
+    // Dterm and flux_ec span the grown pencil since the hyperbolic kernel
+    // writes there; the diffusion operator only fills the valid pencil
+    Dterm = scratch.fab(cbox, NUM_STATE);
+
+    for (int d=0; d<BL_SPACEDIM; ++d) {
+      const Box ebox = amrex::surroundingNodes(bbox,d);
+      flux_ec[d] = scratch.fab(amrex::surroundingNodes(cbox,d), NUM_STATE);
+      flux_ec[d].setVal(0);
+      coeff_ec[d] = scratch.fab(ebox, nCompTr);
+      if (do_diffusion) {
+        BL_PROFILE("PeleC::pc_move_transport_coeffs_to_ec call");
+        pc_move_transport_coeffs_to_ec(ARLIM_3D(bbox.loVect()),
+                                       ARLIM_3D(bbox.hiVect()),
+                                       ARLIM_3D(dbox.loVect()),
+                                       ARLIM_3D(dbox.hiVect()),
+                                       BL_TO_FORTRAN_N_3D(coeff_cc, dComp_ec),
+                                       BL_TO_FORTRAN_N_3D(coeff_ec[d], dComp_ec),
+                                       &d, &nComp_ec, &do_harmonic);
+      }
+#if (BL_SPACEDIM > 1)
+      int nCompTan = AMREX_D_PICK(1, 2, 6);
+      tander_ec[d] = scratch.fab(ebox, nCompTan);
+      tander_ec[d].setVal(0);
+      if (diffuse_vel != 0) {
+        BL_PROFILE("PeleC::pc_compute_tangential_vel_derivs call");
+        pc_compute_tangential_vel_derivs(bbox.loVect(),
+                                         bbox.hiVect(),
+                                         dbox.loVect(),
+                                         dbox.hiVect(),
+                                         BL_TO_FORTRAN_ANYD(Qfab),
+                                         BL_TO_FORTRAN_ANYD(tander_ec[d]),
+                                         geom.CellSize(), &d);
+      }
+#endif
+    }
+
+    if (!do_diffusion) {
+      Dterm.setVal(0);
+    } else {
+      BL_PROFILE("PeleC::pc_diffterm()");
+      pc_diffterm(bbox.loVect(),
+                  bbox.hiVect(),
+                  dbox.loVect(),
+                  dbox.hiVect(),
+                  BL_TO_FORTRAN_ANYD(Qfab),
+                  BL_TO_FORTRAN_N_ANYD(coeff_ec[0], dComp_rhoD),
+                  BL_TO_FORTRAN_N_ANYD(coeff_ec[0], dComp_mu),
+                  BL_TO_FORTRAN_N_ANYD(coeff_ec[0], dComp_xi),
+                  BL_TO_FORTRAN_N_ANYD(coeff_ec[0], dComp_lambda),
+#if (BL_SPACEDIM > 1)
+                  BL_TO_FORTRAN_ANYD(tander_ec[0]),
+#endif
+                  BL_TO_FORTRAN_ANYD(area[0][mfi]),
+                  BL_TO_FORTRAN_ANYD(flux_ec[0]),
+#if (BL_SPACEDIM > 1)
+                  BL_TO_FORTRAN_N_ANYD(coeff_ec[1], dComp_rhoD),
+                  BL_TO_FORTRAN_N_ANYD(coeff_ec[1], dComp_mu),
+                  BL_TO_FORTRAN_N_ANYD(coeff_ec[1], dComp_xi),
+                  BL_TO_FORTRAN_N_ANYD(coeff_ec[1], dComp_lambda),
+                  BL_TO_FORTRAN_ANYD(tander_ec[1]),
+                  BL_TO_FORTRAN_ANYD(area[1][mfi]),
+                  BL_TO_FORTRAN_ANYD(flux_ec[1]),
+#if (BL_SPACEDIM > 2)
+                  BL_TO_FORTRAN_N_ANYD(coeff_ec[2], dComp_rhoD),
+                  BL_TO_FORTRAN_N_ANYD(coeff_ec[2], dComp_mu),
+                  BL_TO_FORTRAN_N_ANYD(coeff_ec[2], dComp_xi),
+                  BL_TO_FORTRAN_N_ANYD(coeff_ec[2], dComp_lambda),
+                  BL_TO_FORTRAN_ANYD(tander_ec[2]),
+                  BL_TO_FORTRAN_ANYD(area[2][mfi]),
+                  BL_TO_FORTRAN_ANYD(flux_ec[2]),
+#endif
+#endif
+                  BL_TO_FORTRAN_ANYD(volume[mfi]),
+                  BL_TO_FORTRAN_ANYD(Dterm),
+                  geom.CellSize(),
+                  &diffuse_vel, &diffuse_spec, &diffuse_ener);
+    }
+
+    if ((NumAux > 0) && !(diffuse_aux == 0)) {
+      BL_PROFILE("PeleC::pc_diffterm_aux()");
+      for (int d=0; d<BL_SPACEDIM; ++d) {
+        pc_diffterm_aux(ARLIM_3D(bbox.loVect()),
+                        ARLIM_3D(bbox.hiVect()),
+                        ARLIM_3D(dbox.loVect()),
+                        ARLIM_3D(dbox.hiVect()),
+                        BL_TO_FORTRAN_ANYD(Qfab),
+                        BL_TO_FORTRAN_N_ANYD(coeff_ec[d], dComp_rhoDaux),
+                        BL_TO_FORTRAN_ANYD(area[d][mfi]),
+                        BL_TO_FORTRAN_ANYD(flux_ec[d]),
+                        BL_TO_FORTRAN_ANYD(volume[mfi]),
+                        BL_TO_FORTRAN_ANYD(Dterm),
+                        geom.CellSize(), &d);
+      }
+    }
+
+    // Shut off unwanted diffusion, as in the reference path
+    if (diffuse_temp == 0 && diffuse_enth == 0) {
+      Dterm.setVal(0, Eden);
+      Dterm.setVal(0, Eint);
+      for (int d = 0; d < BL_SPACEDIM; d++) {
+        flux_ec[d].setVal(0, Eden);
+        flux_ec[d].setVal(0, Eint);
+      }
+    }
+    if (diffuse_spec == 0) {
+      Dterm.setVal(0, Dterm.box(), FirstSpec, NumSpec);
+      for (int d = 0; d < BL_SPACEDIM ; d++) {
+        flux_ec[d].setVal(0, flux_ec[d].box(), FirstSpec, NumSpec);
+      }
+    }
+    if (diffuse_vel  == 0) {
+      Dterm.setVal(0, Dterm.box(), Xmom, 3);
+      for (int d = 0; d < BL_SPACEDIM; d++) {
+        flux_ec[d].setVal(0, flux_ec[d].box(), Xmom, 3);
+      }
+    }
+
+#ifdef PELEC_USE_MOL
+    if (do_hydro && do_mol_AD)
+    {
+      flatn = scratch.fab(cbox,1);
+      flatn.setVal(1.0);
+      // Only regular tiles come here, with no fluxes to redistribute
+      BL_PROFILE("PeleC::pc_hyp_mol_flux_regular call");
+      pc_hyp_mol_flux_regular(bbox.loVect(), bbox.hiVect(),
+                              geom.Domain().loVect(), geom.Domain().hiVect(),
+                              BL_TO_FORTRAN_3D(Qfab),
+                              BL_TO_FORTRAN_3D(Qaux),
+                              BL_TO_FORTRAN_ANYD(area[0][mfi]),
+                              BL_TO_FORTRAN_3D(flux_ec[0]),
+#if (BL_SPACEDIM > 1)
+                              BL_TO_FORTRAN_ANYD(area[1][mfi]),
+                              BL_TO_FORTRAN_3D(flux_ec[1]),
+#if (BL_SPACEDIM > 2)
+                              BL_TO_FORTRAN_ANYD(area[2][mfi]),
+                              BL_TO_FORTRAN_3D(flux_ec[2]),
+#endif
+#endif
+                              BL_TO_FORTRAN_3D(flatn),
+                              BL_TO_FORTRAN_ANYD(volume[mfi]),
+                              BL_TO_FORTRAN_3D(Dterm),
+                              geom.CellSize());
+    }
+#endif
+
+    MOLSrc.copy(Dterm, bbox, 0, bbox, 0, NUM_STATE);
+
+    if (do_flux_reg) {
+      for (int d=0; d<BL_SPACEDIM; ++d) {
+        const Box ebox = amrex::surroundingNodes(bbox,d);
+        flux_tile[d].copy(flux_ec[d], ebox, 0, ebox, 0, NUM_STATE);
+      }
+    }
+  }
+
+  if (do_flux_reg)
+  {
+    for (int d = 0; d < BL_SPACEDIM ; d++) {
+      flux_tile[d].mult(flux_factor);
+    }
+
+    if (level < parent->finestLevel()) {
+      getFluxReg(level+1).CrseAdd(mfi,
+                                  {D_DECL(&flux_tile[0], &flux_tile[1], &flux_tile[2])},
+                                  dxDp, dt, RunOn::Cpu);
+    }
+
+    if (level > 0) {
+      getFluxReg(level).FineAdd(mfi,
+                                {D_DECL(&flux_tile[0], &flux_tile[1], &flux_tile[2])},
+                                dxDp, dt, RunOn::Cpu);
+    }
+  }
+}
+
+// **********************************************************************************************
+void
+PeleC::getTransportCoeffs(const amrex::Box&       box,
+                          const amrex::FArrayBox& Qfab,
+                          amrex::FArrayBox&       coeff_cc) {
+  int dComp_rhoD = 0;
+  int dComp_rhoDaux = dComp_rhoD + NumSpec;
+  int dComp_mu = dComp_rhoDaux + NumAux;
+  int dComp_xi = dComp_mu + 1;
+  int dComp_lambda = dComp_xi + 1;
+  {
+    BL_PROFILE("PeleC::get_transport_coeffs call");
+    get_transport_coeffs(ARLIM_3D(box.loVect()),
+                         ARLIM_3D(box.hiVect()),
+                         BL_TO_FORTRAN_N_3D(Qfab, cQFS),
+                         BL_TO_FORTRAN_N_3D(Qfab, cQTEMP),
+                         BL_TO_FORTRAN_N_3D(Qfab, cQRHO),
+                         BL_TO_FORTRAN_N_3D(coeff_cc, dComp_rhoD),
+                         BL_TO_FORTRAN_N_3D(coeff_cc, dComp_mu),
+                         BL_TO_FORTRAN_N_3D(coeff_cc, dComp_xi),
+                         BL_TO_FORTRAN_N_3D(coeff_cc, dComp_lambda));
+  }
+  if (NumAux > 0 && !(diffuse_aux == 0)) {
+    BL_PROFILE("PeleC::get_transport_coeffs_aux call");
+    get_transport_coeffs_aux(ARLIM_3D(box.loVect()),
+                             ARLIM_3D(box.hiVect()),
+                             BL_TO_FORTRAN_N_3D(Qfab, cQFS),
+                             BL_TO_FORTRAN_N_3D(Qfab, cQTEMP),
+                             BL_TO_FORTRAN_N_3D(Qfab, cQRHO),
+                             BL_TO_FORTRAN_N_3D(coeff_cc, dComp_rhoDaux));
+  }
+}
+
+// **********************************************************************************************
+PeleC::TransportCacheEntry&
+PeleC::transportCacheEntry(const amrex::MFIter& mfi,
+                           const amrex::Box&    tile_gbox,
+                           bool&                force_refresh) {
+  /**
+     Cache entries are owned by one tile, so they are only touched by the
+     thread working on that tile.  A change of tile box (new grids, new
+     tiling or a different number of ghost cells) drops the entry; otherwise
+     the entry is fully refreshed every mol_cache_transport_refresh
+     evaluations when that is positive.
+   */
+  TransportCacheEntry& entry = transport_cache[mfi.LocalTileIndex()];
+  if (entry.coeff.box() != tile_gbox) {
+    int nCompTr = NumSpec + NumAux + 3;
+    entry.coeff.resize(tile_gbox, nCompTr);
+    entry.state.resize(tile_gbox, NumSpec + 2);
+    entry.age = -1;
+  }
+  force_refresh = (entry.age < 0)
+    || (mol_cache_transport_refresh > 0 && entry.age + 1 >= mol_cache_transport_refresh);
+  entry.age = force_refresh ? 0 : entry.age + 1;
+  return entry;
+}
+
+// **********************************************************************************************
+bool
+PeleC::refreshTransportCache(TransportCacheEntry&    entry,
+                             bool                    force_refresh,
+                             const amrex::Box&       box,
+                             const amrex::FArrayBox& Qfab) {
+  /**
+     Recompute the cached coefficients over box if a refresh is forced or if
+     any cell of box has drifted from the state they were built from by more
+     than mol_cache_transport_tol.  The refresh is all-or-nothing over box
+     since the transport kernels work on boxes.  Returns true if refreshed.
+   */
+  if (!force_refresh) {
+    if (mol_cache_transport_tol < 0) {
+      return false;
+    }
+    int changed = 0;
+    {
+      BL_PROFILE("PeleC::pc_transport_state_changed call");
+      pc_transport_state_changed(ARLIM_3D(box.loVect()), ARLIM_3D(box.hiVect()),
+                                 BL_TO_FORTRAN_3D(Qfab),
+                                 BL_TO_FORTRAN_3D(entry.state),
+                                 &mol_cache_transport_tol, &changed);
+    }
+    if (changed == 0) {
+      return false;
+    }
+  }
+
+  getTransportCoeffs(box, Qfab, entry.coeff);
+  entry.state.copy(Qfab, box, cQTEMP, box, 0, 1);
+  entry.state.copy(Qfab, box, cQRHO, box, 1, 1);
+  entry.state.copy(Qfab, box, cQFS, box, 2, NumSpec);
+  return true;
+}
+
+amrex::Box
+PeleC::primitiveAllocBox(const amrex::Box& box) {
+  // Grow even lengths by one cell on the high side, so that the number of
+  // cells, i.e. the component stride, is odd
+  Box abox(box);
+  if (mol_pad_q) {
+    for (int d = 0; d < BL_SPACEDIM; ++d) {
+      if (abox.length(d) % 2 == 0) {
+        abox.growHi(d, 1);
+      }
+    }
+  }
+  return abox;
+}
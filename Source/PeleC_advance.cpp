@@ -1,5 +1,6 @@
 #include <PeleC.H>
 #include <PeleC_F.H>
+#include <TileScratch.H>
 
 #include <cmath>
 
@@ -38,6 +39,10 @@ PeleC::advance (Real time,
     }
   }
 
+  // Count tile scratch memory obtained during this step; it should drop to
+  // zero once the arenas have seen the largest tile
+  TileScratch::resetCounter();
+
   Real dt_new = dt;
   if (do_mol_AD)
   {
@@ -48,6 +53,29 @@ PeleC::advance (Real time,
     dt_new = do_sdc_advance(time, dt, amr_iteration, amr_ncycle);
   }
 
+  if (verbose > 1)
+  {
+    long scratch_bytes = TileScratch::bytesAllocated();
+    ParallelDescriptor::ReduceLongMax(scratch_bytes, ParallelDescriptor::IOProcessorNumber());
+    amrex::Print() << "PeleC::advance(): level " << level << " tile scratch bytes allocated this step (max over ranks): "
+                   << scratch_bytes << std::endl;
+
+    if (overlap_fill)
+    {
+      // Communication hidden behind the overlapped work is at most its time;
+      // the wait is the part that was not hidden.  Fills on levels > 0 and
+      // on later SDC iterations are not overlapped and show up as blocking.
+      Real fill_times[3] = {sborder_fill_overlapped, sborder_fill_wait, sborder_fill_blocking};
+      ParallelDescriptor::ReduceRealMax(fill_times, 3, ParallelDescriptor::IOProcessorNumber());
+      amrex::Print() << "PeleC::advance(): level " << level << " Sborder exchange overlapped with "
+                     << fill_times[0] << " s of work, waited " << fill_times[1] << " s, blocking fills "
+                     << fill_times[2] << " s (max over ranks)" << std::endl;
+    }
+  }
+  sborder_fill_overlapped = 0;
+  sborder_fill_wait = 0;
+  sborder_fill_blocking = 0;
+
   return dt_new;
 }
 
@@ -78,6 +106,10 @@ PeleC::do_mol_advance(Real time,
     get_new_data(Work_Estimate_Type).setVal(0.0);
   }
 
+  if (mol_lsrk_order > 0) {
+    return do_mol_lsrk_advance(time, dt, amr_iteration, amr_ncycle);
+  }
+
   MultiFab& U_old = get_old_data(State_Type);
   MultiFab& U_new = get_new_data(State_Type);
   MultiFab S(grids,dmap,NUM_STATE,0,MFInfo(),Factory());
@@ -100,9 +132,8 @@ PeleC::do_mol_advance(Real time,
 
   // Compute S^{n} = MOLRhs(U^{n})
   if (verbose) { amrex::Print() << "... Computing MOL source term at t^{n} " << std::endl; }
-  FillPatch(*this, Sborder, nGrowTr, time, State_Type, 0, NUM_STATE);
   Real flux_factor = 0;
-  getMOLSrcTerm(Sborder, S, time, dt, flux_factor);
+  fillPatchedMOLSrcTerm(time, S, time, dt, flux_factor);
 
     // Build other (neither spray nor diffusion) sources at t_old
     for (int n = 0; n < src_list.size(); ++n)
@@ -136,9 +167,8 @@ PeleC::do_mol_advance(Real time,
 
   // Compute S^{n+1} = MOLRhs(U^{n+1,*})
   if (verbose) { amrex::Print() << "... Computing MOL source term at t^{n+1} " << std::endl; }
-  FillPatch(*this, Sborder, nGrowTr, time+dt, State_Type, 0, NUM_STATE);
   flux_factor = mol_iters > 1 ?  0 : 1;
-  getMOLSrcTerm(Sborder, S, time, dt, flux_factor);
+  fillPatchedMOLSrcTerm(time+dt, S, time, dt, flux_factor);
 
   // Build other (neither spray nor diffusion) sources at t_new
   for (int n = 0; n < src_list.size(); ++n)
@@ -169,7 +199,7 @@ PeleC::do_mol_advance(Real time,
     MultiFab::Subtract(S, I_R, NumSpec,Eden,      1,       0);
 
     // Compute I_R and U^{n+1} = U^n + dt*(F_{AD} + I_R)
-    react_state(time, dt, false, &S);  // false = not react_init
+    react_or_lag_chemistry(time, dt, S, mol_iters == 1);
   }
 #endif
 
@@ -183,15 +213,14 @@ PeleC::do_mol_advance(Real time,
     for (int mol_iter = 2; mol_iter<=mol_iters; ++mol_iter)
     {
       if (verbose) { amrex::Print() << "... Re-computing MOL source term at t^{n+1} (iter = " << mol_iter << " of " << mol_iters << ")" << std::endl; }
-      FillPatch(*this, Sborder, nGrowTr, time + dt, State_Type, 0, NUM_STATE);
       flux_factor = mol_iter==mol_iters  ?  1  : 0;
-      getMOLSrcTerm(Sborder, S_new, time, dt, flux_factor);
+      fillPatchedMOLSrcTerm(time + dt, S_new, time, dt, flux_factor);
 
       // F_{AD} = (1/2)(S_old + S_new)
       MultiFab::LinComb(S, 0.5, S_old, 0, 0.5, S_new, 0, 0, NUM_STATE, 0);
 
       // Compute I_R and U^{n+1} = U^n + dt*(F_{AD} + I_R)
-      react_state(time, dt, false, &S);  // false = not react_init
+      react_or_lag_chemistry(time, dt, S, mol_iter == mol_iters);
       
       computeTemp(U_new,0);
     }
@@ -205,6 +234,187 @@ PeleC::do_mol_advance(Real time,
   return dt;
 }
 
+Real
+PeleC::do_mol_lsrk_advance(Real time,
+                           Real dt,
+                           int  amr_iteration,
+                           int  amr_ncycle)
+{
+  /**
+     Low-storage (2N) explicit Runge-Kutta MOL advance, selected with
+     pelec.mol_lsrk_order = 3 (Williamson, 3 stages) or 4 (Carpenter and
+     Kennedy, 5 stages).  Each stage is
+
+        dU  = A_i dU + dt (S(U) + I_R)
+        U  += B_i dU
+
+     so only the register dU is needed beyond U_old, U_new and S, whatever
+     the number of stages.  That is one state-sized MultiFab more than the
+     predictor-corrector with mol_iters = 1.  Stage i contributes b_i dt S_i to U^{n+1}, with
+     b_i = sum_{k>=i} B_k prod_{i<m<=k} A_m; its fluxes go to the flux
+     registers with flux_factor = b_i, so that the reflux correction matches
+     the update.  The reaction coupling is that of do_mol_advance, with F_AD
+     taken from the final stage.
+
+     Time levels have already been swapped by do_mol_advance.  The stage
+     states live in the new State_Type data; its time is set to the stage
+     time so that FillPatch returns them, and coarse-fine ghost cells are
+     interpolated at that time.
+  */
+  BL_PROFILE("PeleC::do_mol_lsrk_advance()");
+
+  // Williamson, J. Comput. Phys. 35 (1980) 48-56, case 7
+  static const Real A3[3] = {0.0, -5.0/9.0, -153.0/128.0};
+  static const Real B3[3] = {1.0/3.0, 15.0/16.0, 8.0/15.0};
+  static const Real C3[3] = {0.0, 1.0/3.0, 3.0/4.0};
+
+  // Carpenter and Kennedy, NASA TM-109112 (1994), solution 3
+  static const Real A4[5] = {0.0,
+                             -567301805773.0/1357537059087.0,
+                             -2404267990393.0/2016746695238.0,
+                             -3550918686646.0/2091501179385.0,
+                             -1275806237668.0/842570457699.0};
+  static const Real B4[5] = {1432997174477.0/9575080441755.0,
+                             5161836677717.0/13612068292357.0,
+                             1720146321549.0/2090206949498.0,
+                             3134564353537.0/4481467310338.0,
+                             2277821191437.0/14882151754819.0};
+  static const Real C4[5] = {0.0,
+                             1432997174477.0/9575080441755.0,
+                             2526269341429.0/6820363962896.0,
+                             2006345519317.0/3224310063776.0,
+                             2802321613138.0/2924317926251.0};
+
+  const int nstages = mol_lsrk_order == 3 ? 3 : 5;
+  const Real* A = mol_lsrk_order == 3 ? A3 : A4;
+  const Real* B = mol_lsrk_order == 3 ? B3 : B4;
+  const Real* C = mol_lsrk_order == 3 ? C3 : C4;
+
+  // Weights of the stage right-hand sides in U^{n+1}, for refluxing
+  Real b[5];
+  for (int i = 0; i < nstages; ++i) {
+    b[i] = 0;
+    Real prod = 1;
+    for (int k = i; k < nstages; ++k) {
+      if (k > i) prod *= A[k];
+      b[i] += B[k] * prod;
+    }
+  }
+
+  MultiFab& U_old = get_old_data(State_Type);
+  MultiFab& U_new = get_new_data(State_Type);
+  MultiFab S(grids,dmap,NUM_STATE,0,MFInfo(),Factory());
+  MultiFab dU(grids,dmap,NUM_STATE,0,MFInfo(),Factory());
+
+#ifdef REACTIONS
+  MultiFab& I_R = get_new_data(Reactions_Type);
+#endif
+
+#ifdef PELE_USE_EB
+  set_body_state(U_old);
+  set_body_state(U_new);
+#endif
+
+  for (int i = 0; i < nstages; ++i)
+  {
+    const Real stage_time = time + C[i]*dt;
+    if (i > 0) {
+      state[State_Type].setNewTimeLevel(stage_time);
+    }
+
+    // S_i = MOLRhs(U_{i-1}); U_0 = U^n
+    if (verbose) { amrex::Print() << "... Computing MOL source term for stage " << i+1 << " of " << nstages << std::endl; }
+    fillPatchedMOLSrcTerm(stage_time, S, stage_time, dt, b[i]);
+
+    // Build other (neither spray nor diffusion) sources at the stage time
+    for (int n = 0; n < src_list.size(); ++n)
+    {
+      if (src_list[n] != diff_src
+#ifdef AMREX_PARTICLES
+          && src_list[n] != spray_src
+#endif
+        )
+      {
+        if (i == 0) {
+          construct_old_source(src_list[n], time, dt, amr_iteration, amr_ncycle, 0, 0);
+          MultiFab::Saxpy(S, 1.0, *old_sources[src_list[n]], 0, 0, NUM_STATE, 0);
+        } else {
+          construct_new_source(src_list[n], stage_time, dt, amr_iteration, amr_ncycle, 0, 0);
+          MultiFab::Saxpy(S, 1.0, *new_sources[src_list[n]], 0, 0, NUM_STATE, 0);
+        }
+      }
+    }
+
+#ifdef REACTIONS
+    if (do_react == 1) {
+      MultiFab::Add(S, I_R, 0,       FirstSpec, NumSpec, 0);
+      MultiFab::Add(S, I_R, NumSpec, Eden,      1,       0);
+    }
+#endif
+
+    // dU = A_i*dU + dt*S_i ;  U_i = U_{i-1} + B_i*dU
+    if (i == 0) {
+      MultiFab::Copy(dU, S, 0, 0, NUM_STATE, 0);
+      dU.mult(dt);
+      MultiFab::LinComb(U_new, 1.0, Sborder, 0, B[i], dU, 0, 0, NUM_STATE, 0);
+    } else {
+      MultiFab::LinComb(dU, A[i], dU, 0, dt, S, 0, 0, NUM_STATE, 0);
+      MultiFab::Saxpy(U_new, B[i], dU, 0, 0, NUM_STATE, 0);
+    }
+
+    computeTemp(U_new,0);
+  }
+
+  state[State_Type].setNewTimeLevel(time + dt);
+
+#ifdef REACTIONS
+  if (do_react == 1) {
+    // F_{AD} = (1/dt)(U^{n+1,*} - U^n) - I_R
+    MultiFab::LinComb(S, 1.0/dt, U_new, 0, -1.0/dt, U_old, 0, 0, NUM_STATE, 0);
+    MultiFab::Subtract(S, I_R, 0,      FirstSpec, NumSpec, 0);
+    MultiFab::Subtract(S, I_R, NumSpec,Eden,      1,       0);
+
+    // Compute I_R and U^{n+1} = U^n + dt*(F_{AD} + I_R)
+    react_state(time, dt, false, &S);  // false = not react_init
+
+    computeTemp(U_new,0);
+  }
+#endif
+
+#ifdef PELE_USE_EB
+  set_body_state(U_new);
+#endif
+
+  return dt;
+}
+
+#ifdef REACTIONS
+void
+PeleC::react_or_lag_chemistry(Real time, Real dt, MultiFab& F_AD, bool last_iter)
+{
+  /**
+     U^{n+1} = U^n + dt*(F_{AD} + I_R), with I_R from react_state, or, with
+     react_skip_mol_iters in an iteration that is not the last, the I_R
+     currently held (from the previous iteration or step).
+  */
+  if (last_iter || !react_skip_mol_iters)
+  {
+    react_state(time, dt, false, &F_AD);  // false = not react_init
+    return;
+  }
+
+  if (verbose) { amrex::Print() << "... Lagging I_R in this iteration (react_skip_mol_iters)" << std::endl; }
+
+  MultiFab& U_old = get_old_data(State_Type);
+  MultiFab& U_new = get_new_data(State_Type);
+  MultiFab& I_R = get_new_data(Reactions_Type);
+
+  MultiFab::LinComb(U_new, 1.0, U_old, 0, dt, F_AD, 0, 0, NUM_STATE, 0);
+  MultiFab::Saxpy(U_new, dt, I_R, 0,       FirstSpec, NumSpec, 0);
+  MultiFab::Saxpy(U_new, dt, I_R, NumSpec, Eden,      1,       0);
+}
+#endif
+
 #ifdef AMREX_PARTICLES
 void
 PeleC::set_spray_grid_info(int amr_iteration,
@@ -360,11 +570,61 @@ PeleC::do_sdc_iteration (Real time,
 
 #endif
 
-  if (fill_Sborder)
+  // On the first iteration, the old-time sources need no ghost cells of
+  // Sborder, so with overlap_fill they are built while it is exchanged.
+  // Later iterations have nothing to overlap: the fill is their first step.
+  const bool overlap_Sborder = fill_Sborder && overlap_fill && level == 0 && sub_iteration == 0;
+
+  if (overlap_Sborder)
   {
+    startSborderFill(time);
+  }
+  else if (fill_Sborder)
+  {
+    const Real t0 = ParallelDescriptor::second();
     FillPatch(*this, Sborder, nGrow_Sborder, time, State_Type, 0, NUM_STATE);
+    sborder_fill_blocking += ParallelDescriptor::second() - t0;
   }
-  
+
+  if (sub_iteration==0)
+  {
+    // Build other (neither spray nor diffusion) sources at t_old
+    for (int n = 0; n < src_list.size(); ++n)
+    {
+      // The LES source does a blocking FillPatch of its own, which would
+      // stall the overlap window; it is built once the exchange is done
+      if (src_list[n] != diff_src
+#ifdef AMREX_PARTICLES
+          && src_list[n] != spray_src
+#endif
+          && !(overlap_Sborder && src_list[n] == les_src)
+        )
+      {
+	construct_old_source(src_list[n], time, dt, amr_iteration, amr_ncycle,
+			     sub_iteration, sub_ncycle);
+      }
+    }
+
+    if (overlap_Sborder && do_diffuse)
+    {
+      getMOLSrcTerm(Sborder,*old_sources[diff_src],time,dt,0.5,MOL_INTERIOR_TILES);
+    }
+  }
+
+  if (overlap_Sborder)
+  {
+    finishSborderFill(time);
+
+    for (int n = 0; n < src_list.size(); ++n)
+    {
+      if (src_list[n] == les_src)
+      {
+        construct_old_source(les_src, time, dt, amr_iteration, amr_ncycle,
+                             sub_iteration, sub_ncycle);
+      }
+    }
+  }
+
   if (sub_iteration==0)
   {
 #ifdef AMREX_PARTICLES
@@ -427,20 +687,6 @@ PeleC::do_sdc_iteration (Real time,
     }
 #endif
 
-    // Build other (neither spray nor diffusion) sources at t_old
-    for (int n = 0; n < src_list.size(); ++n)
-    {
-      if (src_list[n] != diff_src
-#ifdef AMREX_PARTICLES
-          && src_list[n] != spray_src
-#endif
-        )
-      {
-	construct_old_source(src_list[n], time, dt, amr_iteration, amr_ncycle,
-			     sub_iteration, sub_ncycle);
-      }
-    }
-
     // Get diffusion source separate from other sources, since it requires grow cells, and we
     //  may want to reuse what we fill-patched for hydro
     if (do_diffuse)
@@ -450,7 +696,8 @@ PeleC::do_sdc_iteration (Real time,
       }
       BL_ASSERT(!do_mol_AD); // Currently this combo only managed through MOL integrator
       Real flux_factor_old = 0.5;
-      getMOLSrcTerm(Sborder,*old_sources[diff_src],time,dt,flux_factor_old);
+      getMOLSrcTerm(Sborder,*old_sources[diff_src],time,dt,flux_factor_old,
+                    overlap_Sborder ? MOL_HALO_TILES : MOL_ALL_TILES);
     }
 
     // Initialize sources at t_new by copying from t_old
@@ -479,9 +726,8 @@ PeleC::do_sdc_iteration (Real time,
     if (verbose) {
       amrex::Print() << "... Computing diffusion terms at t^(n+1," << sub_iteration+1 << ")" << std::endl;
     }
-    FillPatch(*this, Sborder, nGrowTr, time + dt, State_Type, 0, NUM_STATE);
     Real flux_factor_new = sub_iteration==sub_ncycle-1 ? 0.5 : 0;
-    getMOLSrcTerm(Sborder,*new_sources[diff_src],time,dt,flux_factor_new);
+    fillPatchedMOLSrcTerm(time + dt, *new_sources[diff_src], time, dt, flux_factor_new);
   }
 
   // Build other (neither spray nor diffusion) sources at t_new
@@ -532,7 +778,7 @@ PeleC::do_sdc_iteration (Real time,
   // Update I_R and rebuild S_new accordingly
   if (do_react == 1)
   {
-    react_state(time, dt);
+    react_state(time, dt, false, nullptr, sub_iteration);
   }
   else
   {
@@ -656,3 +902,44 @@ PeleC::finalize_sdc_advance(Real time, Real dt, int amr_iteration, int amr_ncycl
   Real cur_time = state[State_Type].curTime();
   set_special_tagging_flag(cur_time);
 }
+
+void
+PeleC::startSborderFill(Real fill_time)
+{
+  /**
+     On level 0 the ghost cells of Sborder are copies of valid data (other
+     grids or periodic images) or physical boundary values, so FillPatch
+     amounts to a FillBoundary plus a local physical boundary fill.  Here the
+     exchange is only started; work that needs no ghost cells of Sborder can
+     run until finishSborderFill.  Finer levels need FillPatch's coarse-fine
+     interpolation, which has no split-phase form.
+  */
+  BL_ASSERT(level == 0);
+  BL_PROFILE("PeleC::startSborderFill()");
+
+  MultiFab::Copy(Sborder, get_data(State_Type, fill_time), 0, 0, NUM_STATE, 0);
+  Sborder.FillBoundary_nowait(geom.periodicity());
+
+  sborder_fill_start = ParallelDescriptor::second();
+}
+
+void
+PeleC::finishSborderFill(Real fill_time)
+{
+  BL_PROFILE("PeleC::finishSborderFill()");
+
+  const Real t_wait = ParallelDescriptor::second();
+  sborder_fill_overlapped += t_wait - sborder_fill_start;
+
+  Sborder.FillBoundary_finish();
+
+  sborder_fill_wait += ParallelDescriptor::second() - t_wait;
+
+  // Same threading as StateData::FillBoundary (see bndry_func_thread_safe)
+#ifdef _OPENMP
+#pragma omp parallel if (bndry_func_thread_safe)
+#endif
+  for (MFIter mfi(Sborder); mfi.isValid(); ++mfi) {
+    setPhysBoundaryValues(Sborder[mfi], State_Type, fill_time, 0, 0, NUM_STATE);
+  }
+}
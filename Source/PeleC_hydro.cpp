@@ -1,5 +1,6 @@
 #include "PeleC.H"
 #include "PeleC_F.H"
+#include "TileScratch.H"
 
 using namespace amrex;
 
@@ -96,7 +97,10 @@ PeleC::construct_hydro_source(const MultiFab& S, Real time, Real dt, int amr_ite
 
 	FArrayBox pradial(Box::TheUnitBox(),1);
 	FArrayBox q, qaux, src_q;
-	IArrayBox bcMask[BL_SPACEDIM];
+	BaseFab<int> bcMask[BL_SPACEDIM];
+
+	// Tile temporaries alias the per-thread scratch arena, see TileScratch.H
+	TileScratch& scratch = TileScratch::get();
 
 	Real cflLoc = -1.0e+200;
 	int is_finest_level = (level == finest_level) ? 1 : 0;
@@ -124,9 +128,10 @@ PeleC::construct_hydro_source(const MultiFab& S, Real time, Real dt, int amr_ite
 	    FArrayBox &source_in  = sources_for_hydro[mfi];
 	    FArrayBox &source_out = hydro_source[mfi];
 
-	    q.resize(qbx, QVAR);
-	    qaux.resize(qbx, NQAUX);
-	    src_q.resize(qbx, QVAR);
+	    scratch.reset();
+	    q = scratch.fab(qbx, QVAR);
+	    qaux = scratch.fab(qbx, NQAUX);
+	    src_q = scratch.fab(qbx, QVAR);
       
 	    ctoprim(ARLIM_3D(qbx.loVect()), ARLIM_3D(qbx.hiVect()),
 		    statein.dataPtr(), ARLIM_3D(statein.loVect()), ARLIM_3D(statein.hiVect()),
@@ -148,7 +153,7 @@ PeleC::construct_hydro_source(const MultiFab& S, Real time, Real dt, int amr_ite
         for(int d=0; d<BL_SPACEDIM; ++d) {
           if (i!=d) TestBox.grow(d,1);
         }
-        bcMask[i].resize(TestBox,1);
+        bcMask[i] = scratch.ifab(TestBox,1);
         bcMask[i].setVal(0);
       }
       
@@ -181,7 +186,7 @@ PeleC::construct_hydro_source(const MultiFab& S, Real time, Real dt, int amr_ite
       // Allocate fabs for fluxes
 	    for (int i = 0; i < BL_SPACEDIM ; i++)  {
 		const Box& bxtmp = amrex::surroundingNodes(fbx,i);
-		flux[i].resize(bxtmp,NUM_STATE);
+		flux[i] = scratch.fab(bxtmp,NUM_STATE);
 	    }
 
 	    if (!DefaultGeometry().IsCartesian()) {
@@ -230,14 +235,14 @@ PeleC::construct_hydro_source(const MultiFab& S, Real time, Real dt, int amr_ite
             {
               for (int i = 0; i < BL_SPACEDIM ; i++)  {
 	        const Box& bxtmp = amrex::surroundingNodes(bx,i);
-	        filtered_flux[i].resize(bxtmp,NUM_STATE);
+	        filtered_flux[i] = scratch.fab(bxtmp,NUM_STATE);
                 les_filter.apply_filter(bxtmp, flux[i], filtered_flux[i], Density, NUM_STATE);
 
                 flux[i].setVal(0);
                 flux[i].copy(filtered_flux[i], Density, Density, NUM_STATE);
               }
 
-              filtered_source_out.resize(bx, NUM_STATE);
+              filtered_source_out = scratch.fab(bx, NUM_STATE);
               les_filter.apply_filter(bx, source_out, filtered_source_out, Density, NUM_STATE);
 
               source_out.setVal(0);
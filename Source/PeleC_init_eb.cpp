@@ -11,6 +11,8 @@ using namespace amrex;
 #include "AMReX_VisMF.H"
 #include "AMReX_PlotFileUtil.H"
 
+#include <map>
+
 #if BL_SPACEDIM > 1
 #include <AMReX_EB2.H>
 #include <AMReX_EB2_IF_Union.H>
@@ -36,6 +38,109 @@ bool PeleC::ebInitialized()
     return eb_initialized;
 }
 
+namespace {
+
+// With eb_stencil_cache, the per cut-cell structures of each box of a
+// level, kept on the rank that built them for the level's next grids; the
+// EB geometry is static, so a box surviving a regrid on the same rank
+// gets them back without the BoxIterator scans, sorts and stencil fills.
+// The stencils are kept in the form getMOLSrcTerm uses, compact with
+// eb_compact_stencils and dense otherwise.
+struct EBStencilCacheEntry
+{
+  std::vector<EBBndryGeom> geom;
+  std::vector<EBBndrySten> grad_stencil;
+  std::vector<FaceSten> flux_interp[BL_SPACEDIM];
+  EBCompactStencils<EBBndryStenC> grad_stencil_c;
+  EBCompactStencils<FaceStenC> flux_interp_c[BL_SPACEDIM];
+  std::vector<EBTileSlice> tile_slices;  // in the box's MFIter tile order
+  BaseFab<int> mask;
+};
+
+using EBStencilCacheKey = std::pair<IntVect,IntVect>;
+
+EBStencilCacheKey cache_key(const Box& bx)
+{
+  return std::make_pair(bx.smallEnd(), bx.bigEnd());
+}
+
+std::vector<std::map<EBStencilCacheKey, EBStencilCacheEntry>> eb_stencil_cache_level;
+
+// Offset of a displacement d in {-1,0,1}^D within the 3^D stencil block
+int compact_offset(const IntVect& d)
+{
+  int o = 0;
+  for (int dir = BL_SPACEDIM-1; dir >= 0; --dir) {
+    o = 3*o + d[dir] + 1;
+  }
+  return o;
+}
+
+// Compact copies of a fab's stencils (eb_compact_stencils): the nonzero
+// entries of each, in the memory order of val, so that the sums of the
+// compact kernels are those of the dense ones without the zero terms
+void compact_bndry_stencils(const std::vector<EBBndrySten>& dense,
+                            EBCompactStencils<EBBndryStenC>& c)
+{
+  const int nval = sizeof(EBBndrySten::val) / sizeof(Real);
+  c.sten.resize(dense.size());
+  c.coef.clear();
+  c.offset.clear();
+  for (int L = 0; L < dense.size(); ++L) {
+    const Real* val = reinterpret_cast<const Real*>(dense[L].val);
+    EBBndryStenC& sc = c.sten[L];
+    sc.bcval_sten = dense[L].bcval_sten;
+    sc.iv = dense[L].iv;
+    sc.iv_base = dense[L].iv_base;
+    sc.start = c.coef.size();
+    for (int m = 0; m < nval; ++m) {
+      if (val[m] != 0) {
+        c.coef.push_back(val[m]);
+        c.offset.push_back(m);
+      }
+    }
+    sc.nnz = c.coef.size() - sc.start;
+  }
+}
+
+void compact_face_stencils(const std::vector<FaceSten>& dense, int idir,
+                           EBCompactStencils<FaceStenC>& c)
+{
+  // val spans the directions other than idir; the offsets are taken in the
+  // full 3^D block so that the kernel needs no face direction
+  const int nval = sizeof(FaceSten::val) / sizeof(Real);
+  int offset[nval];
+  for (int m = 0; m < nval; ++m) {
+    IntVect d(D_DECL(0, 0, 0));
+    int r = m;
+    for (int dir = 0; dir < BL_SPACEDIM; ++dir) {
+      if (dir == idir) continue;
+      d[dir] = r % 3 - 1;
+      r /= 3;
+    }
+    offset[m] = compact_offset(d);
+  }
+
+  c.sten.resize(dense.size());
+  c.coef.clear();
+  c.offset.clear();
+  for (int L = 0; L < dense.size(); ++L) {
+    const Real* val = reinterpret_cast<const Real*>(dense[L].val);
+    FaceStenC& sc = c.sten[L];
+    sc.iv = dense[L].iv;
+    sc.start = c.coef.size();
+    for (int m = 0; m < nval; ++m) {
+      if (val[m] != 0) {
+        c.coef.push_back(val[m]);
+        c.offset.push_back(offset[m]);
+      }
+    }
+    sc.nnz = c.coef.size() - sc.start;
+  }
+}
+
+}
+
 void
 PeleC::init_eb (const Geometry& level_geom, const BoxArray& ba, const DistributionMapping& dm)
 {
@@ -44,6 +149,12 @@ PeleC::init_eb (const Geometry& level_geom, const BoxArray& ba, const Distributi
 
 }
 
+void
+PeleC::clear_eb_stencil_cache ()
+{
+  std::vector<std::map<EBStencilCacheKey, EBStencilCacheEntry>>().swap(eb_stencil_cache_level);
+}
+
 #if BL_SPACEDIM > 1
 
 /**
@@ -95,6 +206,25 @@ PeleC::initialize_eb2_structs() {
 
   auto const& flags = ebfactory.getMultiEBCellFlagFab();
 
+  // Structures of the cut-cell boxes of this level kept from its previous
+  // grids (eb_stencil_cache)
+  if (eb_stencil_cache && eb_stencil_cache_level.size() <= level) {
+    eb_stencil_cache_level.resize(level+1);
+  }
+  std::map<EBStencilCacheKey, EBStencilCacheEntry> no_cache;
+  auto& level_cache = eb_stencil_cache ? eb_stencil_cache_level[level] : no_cache;
+  std::vector<int> cache_hit(vfrac.local_size(), 0);
+
+  // MOL tiles of each fab, with the cut cells each can touch (EBTileSlice)
+  sv_eb_tile_slice.clear();
+  std::vector<std::vector<int>> fab_tiles(vfrac.local_size());
+  for (MFIter mfi(vfrac, MFItInfo().EnableTiling(hydro_tile_size)); mfi.isValid(); ++mfi) {
+    const int t = mfi.LocalTileIndex();
+    if (t >= static_cast<int>(sv_eb_tile_slice.size())) sv_eb_tile_slice.resize(t+1);
+    sv_eb_tile_slice[t].tilebox = mfi.tilebox();
+    fab_tiles[mfi.LocalIndex()].push_back(t);
+  }
+
   for (MFIter mfi(vfrac, false); mfi.isValid(); ++mfi) {
     BaseFab<int>& mfab = ebmask[mfi];
     const Box tbox = mfi.growntilebox();
@@ -109,89 +239,119 @@ PeleC::initialize_eb2_structs() {
     } else if (typ == FabType::covered) {
       mfab.setVal(-1);
     } else if (typ == FabType::singlevalued) {
-      int Ncut = 0;
-      for (BoxIterator bit(tbox); bit.ok(); ++bit) {
-        const EBCellFlag& flag = flagfab(bit(), 0);
+      const EBStencilCacheEntry* cached = nullptr;
+      if (eb_stencil_cache) {
+        auto it = level_cache.find(cache_key(mfi.validbox()));
+        if (it != level_cache.end()) cached = &(it->second);
+      }
 
-        if (!(flag.isRegular() || flag.isCovered())) {
-          Ncut++;
+      if (cached != nullptr) {
+        cache_hit[iLocal] = 1;
+        mfab.copy(cached->mask);
+        sv_eb_bndry_geom[iLocal] = cached->geom;
+        sv_eb_bndry_grad_stencil[iLocal] = cached->grad_stencil;
+        const auto& tiles = fab_tiles[iLocal];
+        for (int n = 0; n < tiles.size(); ++n) {
+          sv_eb_tile_slice[tiles[n]] = cached->tile_slices[n];
         }
-      }
+      } else {
+        int Ncut = 0;
+        for (BoxIterator bit(tbox); bit.ok(); ++bit) {
+          const EBCellFlag& flag = flagfab(bit(), 0);
 
-      sv_eb_bndry_geom[iLocal].resize(Ncut);
-      int ivec = 0;
-      for (BoxIterator bit(tbox); bit.ok(); ++bit) {
-        const EBCellFlag& flag = flagfab(bit(), 0);
+          if (!(flag.isRegular() || flag.isCovered())) {
+            Ncut++;
+          }
+        }
 
-        if (!(flag.isRegular() || flag.isCovered())) {
-          EBBndryGeom& sv_ebg = sv_eb_bndry_geom[iLocal][ivec];
-          ivec++;
-          sv_ebg.iv = bit();
+        sv_eb_bndry_geom[iLocal].resize(Ncut);
+        int ivec = 0;
+        for (BoxIterator bit(tbox); bit.ok(); ++bit) {
+          const EBCellFlag& flag = flagfab(bit(), 0);
 
-          if (mfab.box().contains(bit())) mfab(bit()) = 0;
-        } else {
-          if (flag.isRegular()) {
-            if (mfab.box().contains(bit())) mfab(bit()) = 1;
-          } else if (flag.isCovered()) {
-            if (mfab.box().contains(bit())) mfab(bit()) = -1;
+          if (!(flag.isRegular() || flag.isCovered())) {
+            EBBndryGeom& sv_ebg = sv_eb_bndry_geom[iLocal][ivec];
+            ivec++;
+            sv_ebg.iv = bit();
+
+            if (mfab.box().contains(bit())) mfab(bit()) = 0;
           } else {
-            if (mfab.box().contains(bit())) mfab(bit()) = 2;
+            if (flag.isRegular()) {
+              if (mfab.box().contains(bit())) mfab(bit()) = 1;
+            } else if (flag.isCovered()) {
+              if (mfab.box().contains(bit())) mfab(bit()) = -1;
+            } else {
+              if (mfab.box().contains(bit())) mfab(bit()) = 2;
+            }
           }
         }
-      }
 
-      int Nebg = sv_eb_bndry_geom[iLocal].size();
-
-      // Now call fortran to fill the ebg
-      pc_fill_sv_ebg(BL_TO_FORTRAN_BOX(tbox),
-                     sv_eb_bndry_geom[iLocal].data(), &Ncut,
-                     BL_TO_FORTRAN_ANYD((*volfrac)[mfi]),
-                     BL_TO_FORTRAN_ANYD((*bndrycent)[mfi]),
-                     D_DECL(BL_TO_FORTRAN_ANYD((*eb2areafrac[0])[mfi]),
-                            BL_TO_FORTRAN_ANYD((*eb2areafrac[1])[mfi]),
-                            BL_TO_FORTRAN_ANYD((*eb2areafrac[2])[mfi])));
-
-      sv_eb_bndry_grad_stencil[iLocal].resize(Ncut);
-
-      // Fill in boundary gradient for cut cells in this grown tile
-      const Real dx = geom.CellSize()[0];
-      auto& vec = sv_eb_bndry_geom[iLocal];
-      std::sort(vec.begin(), vec.end());
-
-      // Boundary stencil option: 0 = original, 1 = amrex way, 2 = least squares
-      ParmParse pp("ebd");
-
-      int bgs;
-      bgs = -1;
-      pp.get("boundary_grad_stencil_type", bgs);
-
-      if (bgs == 0) {
-        pc_fill_bndry_grad_stencil(BL_TO_FORTRAN_BOX(tbox),
-                                   sv_eb_bndry_geom[iLocal].data(), &Ncut,
-                                   sv_eb_bndry_grad_stencil[iLocal].data(),
-                                   &Ncut, &dx);
-      } else if (bgs == 1) {
-        amrex::Print() << "This gradient stencil type WIP and not functional!" << bgs << std::endl;
-        amrex::Abort();
-        pc_fill_bndry_grad_stencil_amrex(BL_TO_FORTRAN_BOX(tbox),
-                                         sv_eb_bndry_geom[iLocal].data(), &Ncut,
-                                         sv_eb_bndry_grad_stencil[iLocal].data(),
-                                         &Ncut, &dx);
-
-      } else if (bgs == 2) {
-        amrex::Print() << "This gradient stencil type WIP and not functional!" << bgs << std::endl;
-        amrex::Abort();
-        pc_fill_bndry_grad_stencil_ls(BL_TO_FORTRAN_BOX(tbox),
-                                      sv_eb_bndry_geom[iLocal].data(), &Ncut,
-                                      sv_eb_bndry_grad_stencil[iLocal].data(),
-                                      &Ncut, &dx);
-      } else {
-        amrex::Print() << "Unknown or unspeciesified boundary gradient stencil type:" << bgs << std::endl;
-        amrex::Abort();
+        int Nebg = sv_eb_bndry_geom[iLocal].size();
+
+        // Now call fortran to fill the ebg
+        pc_fill_sv_ebg(BL_TO_FORTRAN_BOX(tbox),
+                       sv_eb_bndry_geom[iLocal].data(), &Ncut,
+                       BL_TO_FORTRAN_ANYD((*volfrac)[mfi]),
+                       BL_TO_FORTRAN_ANYD((*bndrycent)[mfi]),
+                       D_DECL(BL_TO_FORTRAN_ANYD((*eb2areafrac[0])[mfi]),
+                              BL_TO_FORTRAN_ANYD((*eb2areafrac[1])[mfi]),
+                              BL_TO_FORTRAN_ANYD((*eb2areafrac[2])[mfi])));
+
+        sv_eb_bndry_grad_stencil[iLocal].resize(Ncut);
+
+        // Fill in boundary gradient for cut cells in this grown tile
+        const Real dx = geom.CellSize()[0];
+        auto& vec = sv_eb_bndry_geom[iLocal];
+        std::sort(vec.begin(), vec.end());
+
+        // The cut cells each tile can touch; their per-tile arrays are
+        // filled once the stencils are complete
+        for (int t : fab_tiles[iLocal]) {
+          EBTileSlice& ts = sv_eb_tile_slice[t];
+          ts.win.clear();
+          const Box wbox = amrex::grow(ts.tilebox, vfrac.nGrow());
+          for (int L = 0; L < Ncut; ++L) {
+            if (wbox.contains(vec[L].iv)) {
+              ts.win.push_back(L);
+            }
+          }
+        }
+
+        // Boundary stencil option: 0 = original, 1 = amrex way, 2 = least squares
+        ParmParse pp("ebd");
+
+        int bgs;
+        bgs = -1;
+        pp.get("boundary_grad_stencil_type", bgs);
+
+        if (bgs == 0) {
+          pc_fill_bndry_grad_stencil(BL_TO_FORTRAN_BOX(tbox),
+                                     sv_eb_bndry_geom[iLocal].data(), &Ncut,
+                                     sv_eb_bndry_grad_stencil[iLocal].data(),
+                                     &Ncut, &dx);
+        } else if (bgs == 1) {
+          amrex::Print() << "This gradient stencil type WIP and not functional!" << bgs << std::endl;
+          amrex::Abort();
+          pc_fill_bndry_grad_stencil_amrex(BL_TO_FORTRAN_BOX(tbox),
+                                           sv_eb_bndry_geom[iLocal].data(), &Ncut,
+                                           sv_eb_bndry_grad_stencil[iLocal].data(),
+                                           &Ncut, &dx);
+
+        } else if (bgs == 2) {
+          amrex::Print() << "This gradient stencil type WIP and not functional!" << bgs << std::endl;
+          amrex::Abort();
+          pc_fill_bndry_grad_stencil_ls(BL_TO_FORTRAN_BOX(tbox),
+                                        sv_eb_bndry_geom[iLocal].data(), &Ncut,
+                                        sv_eb_bndry_grad_stencil[iLocal].data(),
+                                        &Ncut, &dx);
+        } else {
+          amrex::Print() << "Unknown or unspeciesified boundary gradient stencil type:" << bgs << std::endl;
+          amrex::Abort();
+        }
       }
 
-      sv_eb_flux[iLocal].define(sv_eb_bndry_grad_stencil[iLocal], NUM_STATE);
-      sv_eb_bcval[iLocal].define(sv_eb_bndry_grad_stencil[iLocal], QVAR);
+      sv_eb_flux[iLocal].define(sv_eb_bndry_geom[iLocal], NUM_STATE);
+      sv_eb_bcval[iLocal].define(sv_eb_bndry_geom[iLocal], QVAR);
 
       if (eb_isothermal && (diffuse_temp != 0 || diffuse_enth != 0)) {
           sv_eb_bcval[iLocal].setVal(eb_boundary_T, cQTEMP);
@@ -228,6 +388,10 @@ PeleC::initialize_eb2_structs() {
       int iLocal = mfi.LocalIndex();
 
       if (typ == FabType::regular || typ == FabType::covered) {
+      } else if (typ == FabType::singlevalued && cache_hit[iLocal]) {
+        if (!eb_compact_stencils) {
+          flux_interp_stencil[idir][iLocal] = level_cache[cache_key(mfi.validbox())].flux_interp[idir];
+        }
       } else if (typ == FabType::singlevalued) {
         const Box ebox = Box(tbox).surroundingNodes(idir);
         const CutFab&  afrac_fab = (*eb2areafrac[idir])[mfi];
@@ -266,6 +430,161 @@ PeleC::initialize_eb2_structs() {
       }
     }
   }
+
+  // Compact stencils for the MOL kernels, which replace the dense ones (the
+  // dense stencils are released).  Boxes found in eb_stencil_cache get
+  // theirs from it.
+  sv_eb_bndry_grad_stencil_c.clear();
+  for (int idir = 0; idir < BL_SPACEDIM; ++idir) {
+    flux_interp_stencil_c[idir].clear();
+  }
+  if (eb_compact_stencils) {
+    sv_eb_bndry_grad_stencil_c.resize(vfrac.local_size());
+    for (int idir = 0; idir < BL_SPACEDIM; ++idir) {
+      flux_interp_stencil_c[idir].resize(vfrac.local_size());
+    }
+    for (MFIter mfi(vfrac, false); mfi.isValid(); ++mfi) {
+      const int i = mfi.LocalIndex();
+      if (cache_hit[i]) {
+        const EBStencilCacheEntry& cached = level_cache[cache_key(mfi.validbox())];
+        sv_eb_bndry_grad_stencil_c[i] = cached.grad_stencil_c;
+        for (int idir = 0; idir < BL_SPACEDIM; ++idir) {
+          flux_interp_stencil_c[idir][i] = cached.flux_interp_c[idir];
+        }
+        continue;
+      }
+      compact_bndry_stencils(sv_eb_bndry_grad_stencil[i], sv_eb_bndry_grad_stencil_c[i]);
+      std::vector<EBBndrySten>().swap(sv_eb_bndry_grad_stencil[i]);
+      for (int idir = 0; idir < BL_SPACEDIM; ++idir) {
+        compact_face_stencils(flux_interp_stencil[idir][i], idir, flux_interp_stencil_c[idir][i]);
+        std::vector<FaceSten>().swap(flux_interp_stencil[idir][i]);
+      }
+    }
+  }
+
+  // Contiguous per-tile copies of the cut cells of each window, read by
+  // the EB kernels of getMOLSrcTerm (EBTileSlice).  The geometry and the
+  // boundary values are static, so this is done here rather than per call.
+  for (MFIter mfi(vfrac, false); mfi.isValid(); ++mfi) {
+    const int i = mfi.LocalIndex();
+    if (sv_eb_bndry_geom[i].empty() || cache_hit[i]) continue;
+    const int Ncut = sv_eb_bndry_geom[i].size();
+    for (int t : fab_tiles[i]) {
+      EBTileSlice& ts = sv_eb_tile_slice[t];
+      const int n = ts.win.size();
+      ts.whole = (n == Ncut);
+      if (ts.whole) continue;
+      ts.geom.resize(n);
+      ts.bcval.resize(QVAR * n);
+      if (eb_compact_stencils) {
+        ts.sten_c.resize(n);
+      } else {
+        ts.sten.resize(n);
+      }
+      for (int L = 0; L < n; ++L) {
+        const int W = ts.win[L];
+        ts.geom[L] = sv_eb_bndry_geom[i][W];
+        if (eb_compact_stencils) {
+          ts.sten_c[L] = sv_eb_bndry_grad_stencil_c[i].sten[W];
+        } else {
+          ts.sten[L] = sv_eb_bndry_grad_stencil[i][W];
+        }
+        for (int c = 0; c < QVAR; ++c) {
+          ts.bcval[c * n + L] = sv_eb_bcval[i](W, c);
+        }
+      }
+    }
+  }
+
+  if (eb_stencil_cache) {
+    // Keep the structures of the current cut-cell boxes for the next
+    // grids of the level: moved from the cache for the hits, copied
+    // otherwise
+    std::map<EBStencilCacheKey, EBStencilCacheEntry> new_cache;
+    long nboxes[2] = {0, 0};
+    for (MFIter mfi(vfrac, false); mfi.isValid(); ++mfi) {
+      const int iLocal = mfi.LocalIndex();
+      if (sv_eb_bndry_geom[iLocal].empty()) continue;
+
+      const EBStencilCacheKey key = cache_key(mfi.validbox());
+      EBStencilCacheEntry& entry = new_cache[key];
+      nboxes[0]++;
+      if (cache_hit[iLocal]) {
+        nboxes[1]++;
+        entry = std::move(level_cache[key]);
+        continue;
+      }
+      entry.geom = sv_eb_bndry_geom[iLocal];
+      if (eb_compact_stencils) {
+        entry.grad_stencil_c = sv_eb_bndry_grad_stencil_c[iLocal];
+        for (int idir = 0; idir < BL_SPACEDIM; ++idir) {
+          entry.flux_interp_c[idir] = flux_interp_stencil_c[idir][iLocal];
+        }
+      } else {
+        entry.grad_stencil = sv_eb_bndry_grad_stencil[iLocal];
+        for (int idir = 0; idir < BL_SPACEDIM; ++idir) {
+          entry.flux_interp[idir] = flux_interp_stencil[idir][iLocal];
+        }
+      }
+      for (int t : fab_tiles[iLocal]) {
+        entry.tile_slices.push_back(sv_eb_tile_slice[t]);
+      }
+      entry.mask.resize(ebmask[mfi].box());
+      entry.mask.copy(ebmask[mfi]);
+    }
+    level_cache.swap(new_cache);
+
+    if (verbose) {
+      long cache_bytes = 0;
+      for (const auto& kv : level_cache) {
+        const EBStencilCacheEntry& e = kv.second;
+        cache_bytes += e.geom.size() * sizeof(EBBndryGeom)
+          + e.grad_stencil.size() * sizeof(EBBndrySten)
+          + e.grad_stencil_c.nBytes() + e.mask.nBytes();
+        for (int idir = 0; idir < BL_SPACEDIM; ++idir) {
+          cache_bytes += e.flux_interp[idir].size() * sizeof(FaceSten) + e.flux_interp_c[idir].nBytes();
+        }
+        for (const auto& ts : e.tile_slices) {
+          cache_bytes += ts.nBytes();
+        }
+      }
+      ParallelDescriptor::ReduceLongSum(nboxes, 2, ParallelDescriptor::IOProcessorNumber());
+      ParallelDescriptor::ReduceLongSum(cache_bytes, ParallelDescriptor::IOProcessorNumber());
+      amrex::Print() << "PeleC::initialize_eb2_structs(): level " << level << " EB stencil cache hits "
+                     << nboxes[1] << " of " << nboxes[0] << " cut-cell boxes ("
+                     << (nboxes[0] > 0 ? 100.0*nboxes[1]/nboxes[0] : 0.0) << "%), "
+                     << cache_bytes << " bytes" << std::endl;
+    }
+  }
+
+  if (verbose) {
+    // Memory of the per cut-cell structures; sv_eb_flux and sv_eb_bcval
+    // refer to the geometry, with eb_compact_stencils only the compact
+    // stencils are held
+    long bytes[4] = {0, 0, 0, 0};
+    for (int i = 0; i < sv_eb_bndry_geom.size(); ++i) {
+      bytes[0] += sv_eb_bndry_geom[i].size() * sizeof(EBBndryGeom);
+      bytes[1] += sv_eb_bndry_grad_stencil[i].size() * sizeof(EBBndrySten);
+      for (int idir = 0; idir < BL_SPACEDIM; ++idir) {
+        bytes[2] += flux_interp_stencil[idir][i].size() * sizeof(FaceSten);
+      }
+      if (eb_compact_stencils) {
+        bytes[1] += sv_eb_bndry_grad_stencil_c[i].nBytes();
+        for (int idir = 0; idir < BL_SPACEDIM; ++idir) {
+          bytes[2] += flux_interp_stencil_c[idir][i].nBytes();
+        }
+      }
+      bytes[3] += sv_eb_flux[i].nBytes() + sv_eb_bcval[i].nBytes();
+    }
+    for (const auto& ts : sv_eb_tile_slice) {
+      bytes[3] += ts.nBytes();
+    }
+    ParallelDescriptor::ReduceLongSum(bytes, 4, ParallelDescriptor::IOProcessorNumber());
+    amrex::Print() << "PeleC::initialize_eb2_structs(): level " << level << " EB bytes: geometry "
+                   << bytes[0] << ", boundary stencils " << bytes[1] << ", flux interpolation stencils "
+                   << bytes[2] << ", fluxes, boundary values and tile slices " << bytes[3] << ", total "
+                   << bytes[0] + bytes[1] + bytes[2] + bytes[3] << std::endl;
+  }
 }
 
 void
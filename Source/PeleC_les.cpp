@@ -1,5 +1,6 @@
 #include <PeleC.H>
 #include <PeleC_F.H>
+#include <TileScratch.H>
 
 using std::string;
 using namespace amrex;
@@ -155,9 +156,12 @@ PeleC::getSmagorinskyLESTerm (amrex::Real time, amrex::Real dt, amrex::MultiFab&
     FArrayBox flux_ec[BL_SPACEDIM], tander_ec[BL_SPACEDIM];
     IArrayBox bcMask;
 
+    // Tile temporaries alias the per-thread scratch arena, see TileScratch.H
+    TileScratch& scratch = TileScratch::get();
 
     for (MFIter mfi(S, MFItInfo().EnableTiling(hydro_tile_size).SetDynamic(true)); mfi.isValid(); ++mfi)
     {
+      scratch.reset();
       const Box  vbox = mfi.tilebox();
       const Box  gbox = amrex::grow(vbox,ngrow);
       const Box  cbox = amrex::grow(vbox,ngrow-1);
@@ -175,9 +179,9 @@ PeleC::getSmagorinskyLESTerm (amrex::Real time, amrex::Real dt, amrex::MultiFab&
 #endif
 
 
-      Qfab.resize(gbox,QVAR);
+      Qfab = scratch.fab(gbox,QVAR);
       int nqaux = NQAUX > 0 ? NQAUX : 1;
-      Qaux.resize(gbox,nqaux);
+      Qaux = scratch.fab(gbox,nqaux);
 
       { // Get primitives, Q, including (Y, T, p, rho) from conserved state, required for L term
         BL_PROFILE("PeleC::ctoprim call");
@@ -188,17 +192,17 @@ PeleC::getSmagorinskyLESTerm (amrex::Real time, amrex::Real dt, amrex::MultiFab&
       }
 
       // Container on grown region, required to support hybrid divergence and redistribution
-      Lterm.resize(cbox,NUM_STATE);
+      Lterm = scratch.fab(cbox,NUM_STATE);
 
       // Get the tangential derivatives
       for (int d=0; d<BL_SPACEDIM; ++d)
       {
         Box ebox = amrex::surroundingNodes(cbox,d);
-        flux_ec[d].resize(ebox,NUM_STATE);  flux_ec[d].setVal(0);
+        flux_ec[d] = scratch.fab(ebox,NUM_STATE);  flux_ec[d].setVal(0);
 
 #if (BL_SPACEDIM > 1)
         int nCompTan = AMREX_D_PICK(1, 2, 6);
-        tander_ec[d].resize(ebox,nCompTan); tander_ec[d].setVal(0);
+        tander_ec[d] = scratch.fab(ebox,nCompTan); tander_ec[d].setVal(0);
         {
           BL_PROFILE("PeleC::pc_compute_tangential_vel_derivs call");
           pc_compute_tangential_vel_derivs(cbox.loVect(), cbox.hiVect(),
@@ -323,8 +327,13 @@ PeleC::getDynamicSmagorinskyLESTerm (amrex::Real time, amrex::Real dt, amrex::Mu
     FArrayBox Qfab, Qaux, Lterm;
     FArrayBox coeff_ec[BL_SPACEDIM], flux_ec[BL_SPACEDIM];
     IArrayBox bcMask;
+
+    // Tile temporaries alias the per-thread scratch arena, see TileScratch.H
+    TileScratch& scratch = TileScratch::get();
+
     for (MFIter mfi(S, MFItInfo().EnableTiling(hydro_tile_size).SetDynamic(true)); mfi.isValid(); ++mfi)
     {
+      scratch.reset();
 
       const Box  vbox = mfi.tilebox();
       const Box  g0box = amrex::grow(vbox,nGrowD+nGrowC+nGrowT+1);
@@ -346,9 +355,9 @@ PeleC::getDynamicSmagorinskyLESTerm (amrex::Real time, amrex::Real dt, amrex::Mu
       const FArrayBox& Sfab = S[mfi];
 #endif
 
-      Qfab.resize(g0box,QVAR);
+      Qfab = scratch.fab(g0box,QVAR);
       int nqaux = NQAUX > 0 ? NQAUX : 1;
-      Qaux.resize(g0box,nqaux);
+      Qaux = scratch.fab(g0box,nqaux);
 
       { // Get primitives, Q, including (Y, T, p, rho) from conserved state, required for L term
         BL_PROFILE("PeleC::ctoprim call");
@@ -359,7 +368,7 @@ PeleC::getDynamicSmagorinskyLESTerm (amrex::Real time, amrex::Real dt, amrex::Mu
       }
 
       // Container on grown region, required to support hybrid divergence and redistribution
-      Lterm.resize(cbox,NUM_STATE);
+      Lterm = scratch.fab(cbox,NUM_STATE);
 
       
       // 2. Get dynamic Smagorinsky derived quantities after setting the
@@ -367,11 +376,11 @@ PeleC::getDynamicSmagorinskyLESTerm (amrex::Real time, amrex::Real dt, amrex::Mu
       // them at the test filter level. All are located at cell centers.
       const int upper_triangle_n = static_cast<int>(0.5*BL_SPACEDIM*(BL_SPACEDIM+1));
       FArrayBox K, RUT, alphaij, alpha, flux_T;
-      K.resize(g1box, upper_triangle_n);
-      RUT.resize(g1box, BL_SPACEDIM);
-      alphaij.resize(g1box, BL_SPACEDIM*BL_SPACEDIM);
-      alpha.resize(g1box, 1);
-      flux_T.resize(g1box, BL_SPACEDIM);
+      K = scratch.fab(g1box, upper_triangle_n);
+      RUT = scratch.fab(g1box, BL_SPACEDIM);
+      alphaij = scratch.fab(g1box, BL_SPACEDIM*BL_SPACEDIM);
+      alpha = scratch.fab(g1box, 1);
+      flux_T = scratch.fab(g1box, BL_SPACEDIM);
 
       {
         BL_PROFILE("PeleC::pc_smagorinsky_sfs_term()");
@@ -391,14 +400,14 @@ PeleC::getDynamicSmagorinskyLESTerm (amrex::Real time, amrex::Real dt, amrex::Mu
       // 3. Filter the state variables and the derived quantities at the
       // test filter level - still at cell centers
       FArrayBox filtered_S, filtered_Q, filtered_Qaux, filtered_K, filtered_RUT, filtered_alphaij, filtered_alpha, filtered_flux_T;
-      filtered_S.resize(g2box,NUM_STATE);
-      filtered_Q.resize(g2box,QVAR);
-      filtered_Qaux.resize(g2box,NQAUX>0?NQAUX:1);
-      filtered_K.resize(g3box,upper_triangle_n);
-      filtered_RUT.resize(g3box,BL_SPACEDIM);
-      filtered_alphaij.resize(g3box,BL_SPACEDIM*BL_SPACEDIM);
-      filtered_alpha.resize(g3box,1);
-      filtered_flux_T.resize(g3box,BL_SPACEDIM);
+      filtered_S = scratch.fab(g2box,NUM_STATE);
+      filtered_Q = scratch.fab(g2box,QVAR);
+      filtered_Qaux = scratch.fab(g2box,NQAUX>0?NQAUX:1);
+      filtered_K = scratch.fab(g3box,upper_triangle_n);
+      filtered_RUT = scratch.fab(g3box,BL_SPACEDIM);
+      filtered_alphaij = scratch.fab(g3box,BL_SPACEDIM*BL_SPACEDIM);
+      filtered_alpha = scratch.fab(g3box,1);
+      filtered_flux_T = scratch.fab(g3box,BL_SPACEDIM);
 
       test_filter.apply_filter(g2box, Sfab, filtered_S);
       ctoprim(ARLIM_3D(g2box.loVect()), ARLIM_3D(g2box.hiVect()),
@@ -416,7 +425,7 @@ PeleC::getDynamicSmagorinskyLESTerm (amrex::Real time, amrex::Real dt, amrex::Mu
       // 4. Calculate the dynamic Smagorinsky coefficients - still at cell centers
       int do_harmonic = 1;
       FArrayBox coeff_cc;
-      coeff_cc.resize(g3box, nCompC);
+      coeff_cc = scratch.fab(g3box, nCompC);
 
       {
         BL_PROFILE("PeleC::pc_dynamic_smagorinsky_coeffs()");
@@ -448,11 +457,11 @@ PeleC::getDynamicSmagorinskyLESTerm (amrex::Real time, amrex::Real dt, amrex::Mu
 	int onedim=1;
 	int ndims = BL_SPACEDIM;
         Box ebox = amrex::surroundingNodes(cbox,d);
-        flux_ec[d].resize(ebox,NUM_STATE); flux_ec[d].setVal(0);
-        coeff_ec[d].resize(ebox,nCompC);
-        alphaij_ec[d].resize(ebox,BL_SPACEDIM);
-        alpha_ec[d].resize(ebox,1);
-        flux_T_ec[d].resize(ebox,1);
+        flux_ec[d] = scratch.fab(ebox,NUM_STATE); flux_ec[d].setVal(0);
+        coeff_ec[d] = scratch.fab(ebox,nCompC);
+        alphaij_ec[d] = scratch.fab(ebox,BL_SPACEDIM);
+        alpha_ec[d] = scratch.fab(ebox,1);
+        flux_T_ec[d] = scratch.fab(ebox,1);
         pc_move_transport_coeffs_to_ec(ARLIM_3D(cbox.loVect()), ARLIM_3D(cbox.hiVect()),
                                        ARLIM_3D(dbox.loVect()), ARLIM_3D(dbox.hiVect()),
                                        BL_TO_FORTRAN_ANYD(LES_Coeffs[mfi]),
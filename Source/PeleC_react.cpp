@@ -6,16 +6,24 @@
 
 #ifdef PELE_USE_EB
 #include <AMReX_MultiCutFab.H>
+#include <AMReX_EBFabFactory.H>
 #endif
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+
 using std::string;
 using namespace amrex;
 
 void
-PeleC::react_state(Real time, Real dt, bool react_init, MultiFab* A_aux)
+PeleC::react_state(Real time, Real dt, bool react_init, MultiFab* A_aux, int sdc_iteration)
 {
   /*
-    Update I_R, and recompute S_new
+    Update I_R, and recompute S_new.  sdc_iteration is the SDC sweep of the
+    step (0 outside SDC), for react_sdc_reuse.
    */
     BL_PROFILE("PeleC::react_state()");
 
@@ -37,7 +45,19 @@ PeleC::react_state(Real time, Real dt, bool react_init, MultiFab* A_aux)
     // Build the burning mask, in case the state has ghost zones.
 
     const int ng = S_new.nGrow();
-    auto interior_mask = build_interior_boundary_mask(ng);
+    const iMultiFab* interior_mask = build_interior_boundary_mask(ng);
+
+    // With react_skip_covered, also leave out the cells under the next
+    // finer level (react_init still integrates every cell)
+    iMultiFab covered_mask;
+    long n_covered = 0;
+    if (react_skip_covered && !react_init && level < parent->finestLevel())
+    {
+      covered_mask.define(grids, dmap, 1, ng, MFInfo(), DefaultFabFactory<IArrayBox>());
+      iMultiFab::Copy(covered_mask, *interior_mask, 0, 0, 1, ng);
+      n_covered = mask_covered_cells(covered_mask);
+      interior_mask = &covered_mask;
+    }
 
     // Create a MultiFab with all of the non-reacting source terms.
 
@@ -77,93 +97,507 @@ PeleC::react_state(Real time, Real dt, bool react_init, MultiFab* A_aux)
     }
 
     MultiFab& reactions = get_new_data(Reactions_Type);
-    reactions.setVal(0.0);
 
-    if (use_reactions_work_estimate) {
-	amrex::Abort("Need to implement redistribution of chemistry work");
+    // With react_sdc_reuse, the sweeps after the first integrate only the
+    // cells whose forcing changed by more than react_sdc_reuse_tol since
+    // their last integration in this step; the others keep its I_R (see
+    // pc_react_sdc_reuse).  The first sweep integrates every cell.
+    const bool sdc_reuse = react_sdc_reuse && !react_init && A_aux == nullptr;
+    iMultiFab reuse_mask;
+    long n_reused = 0;
+    if (sdc_reuse && sdc_iteration == 0)
+    {
+      if (sdc_react_A.empty()) {
+        sdc_react_A.define(grids, dmap, NumSpec+1, 0, MFInfo(), Factory());
+      }
+      MultiFab::Copy(sdc_react_A, *Ap, FirstSpec, 0, NumSpec, 0);
+      MultiFab::Copy(sdc_react_A, *Ap, Eden, NumSpec, 1, 0);
     }
+    else if (sdc_reuse)
+    {
+      MultiFab IR_prev(grids, dmap, reactions.nComp(), 0, MFInfo(), Factory());
+      MultiFab::Copy(IR_prev, reactions, 0, 0, reactions.nComp(), 0);
+      reactions.setVal(0.0);
+
+      reuse_mask.define(grids, dmap, 1, ng, MFInfo(), DefaultFabFactory<IArrayBox>());
+      iMultiFab::Copy(reuse_mask, *interior_mask, 0, 0, 1, ng);
+
+      const MultiFab& S_old = get_old_data(State_Type);
+      const Real tol = react_sdc_reuse_tol;
 
 #ifdef _OPENMP
-#pragma omp parallel
+#pragma omp parallel reduction(+:n_reused)
 #endif
+      for (MFIter mfi(S_new, true); mfi.isValid(); ++mfi)
+      {
+        // Valid cells only; the ghost cells are integrated
+        const Box& bx = mfi.tilebox();
+        IArrayBox& m = reuse_mask[mfi];
+        int tile_reused = 0;
+        pc_react_sdc_reuse(ARLIM_3D(bx.loVect()), ARLIM_3D(bx.hiVect()),
+                           BL_TO_FORTRAN_3D(S_old[mfi]),
+                           BL_TO_FORTRAN_3D(S_new[mfi]),
+                           BL_TO_FORTRAN_3D((*Ap)[mfi]),
+                           BL_TO_FORTRAN_3D(sdc_react_A[mfi]),
+                           BL_TO_FORTRAN_3D(IR_prev[mfi]),
+                           BL_TO_FORTRAN_3D(reactions[mfi]),
+                           m.dataPtr(), ARLIM_3D(m.loVect()), ARLIM_3D(m.hiVect()),
+                           &dt, &tol, &tile_reused);
+        n_reused += tile_reused;
+      }
+
+      interior_mask = &reuse_mask;
+    }
+    if (!(sdc_reuse && sdc_iteration > 0))
     {
+      reactions.setVal(0.0);
+    }
 
-        FArrayBox w;
-        for (MFIter mfi(S_new, true); mfi.isValid(); ++mfi)
-        {
+    long n_integrated = 0;
+    long n_frozen = 0;
+    Real t_busy = 0.0;
+    Real t_wall = 0.0;
 
-            const Box& bx = mfi.growntilebox(ng);
+    if (use_reactions_work_estimate && !react_init)
+    {
+      react_state_redistributed(time, dt, *Ap, *interior_mask, ng, n_integrated, n_frozen, t_busy, t_wall);
+    }
+    else
+    {
+      const MultiFab& S_old = react_init ? S_new : get_old_data(State_Type);
+      MultiFab* work = (do_react_load_balance || do_mol_load_balance) ? &get_new_data(Work_Estimate_Type) : nullptr;
+      const MultiFab* cost = (work != nullptr && !react_init) ? &get_old_data(Work_Estimate_Type) : nullptr;
+      react_state_boxes(time, dt, react_init, S_old, S_new, *Ap, *interior_mask, reactions,
+                        chemStepData(), work, cost, ng, n_integrated, n_frozen,
+                        t_busy, t_wall);
+    }
+
+    if (ng > 0)
+        S_new.FillBoundary(geom.periodicity());
+
+    if (verbose > 1) {
+
+        const int IOProc   = ParallelDescriptor::IOProcessorNumber();
+        Real      run_time = ParallelDescriptor::second() - strt_time;
+
+        // Chemistry table statistics since the last report (see react_cache.f90)
+        long cache_cells[3] = {0, 0, 0};
+        Real cache_err[2] = {0, 0};
+        if (react_cache_size > 0) {
+            long long hits, misses, checks;
+            pc_react_cache_stats(&hits, &misses, &checks, &cache_err[0], &cache_err[1]);
+            cache_cells[0] = hits;
+            cache_cells[1] = misses;
+            cache_cells[2] = checks;
+        }
+
+#ifdef BL_LAZY
+        Lazy::QueueReduction( [=] () mutable {
+#endif
+                ParallelDescriptor::ReduceRealMax(run_time, IOProc);
+
+                long cells[4] = {n_integrated, n_frozen, n_reused, n_covered};
+                ParallelDescriptor::ReduceLongSum(cells, 4, IOProc);
+
+                Real thread_time[2] = {t_busy, t_wall};
+                ParallelDescriptor::ReduceRealSum(thread_time, 2, IOProc);
+
+                if (react_cache_size > 0) {
+                    ParallelDescriptor::ReduceLongSum(cache_cells, 3, IOProc);
+                    ParallelDescriptor::ReduceRealMax(cache_err[0], IOProc);
+                    ParallelDescriptor::ReduceRealSum(cache_err[1], IOProc);
+                }
+
+                if (ParallelDescriptor::IOProcessor()) {
+                std::cout << "PeleC::react_state() time = " << run_time << "\n";
+                std::cout << "PeleC::react_state() cells integrated = " << cells[0]
+                          << ", skipped as chemically frozen = " << cells[1] << "\n";
+                if (sdc_reuse) {
+                    std::cout << "PeleC::react_state() SDC sweep " << sdc_iteration + 1
+                              << ": cells fully integrated = " << cells[0] + cells[1]
+                              << ", corrected with the previous sweep's I_R = " << cells[2] << "\n";
+                }
+                std::cout << "PeleC::react_state() thread idle time = "
+                          << (thread_time[1] > 0 ? 100.0*(1.0 - thread_time[0]/thread_time[1]) : 0.0)
+                          << "% of the threaded loop (" << (react_dynamic_schedule ? "dynamic" : "static")
+                          << " schedule)\n";
+                if (cells[3] > 0) {
+                    std::cout << "PeleC::react_state() level " << level << " cells skipped as covered by level "
+                              << level+1 << " = " << cells[3] << " ("
+                              << 100.0*cells[3]/grids.numPts() << "% of the level)\n";
+                }
+                if (react_cache_size > 0) {
+                    const long lookups = cache_cells[0] + cache_cells[1];
+                    std::cout << "PeleC::react_state() chemistry table hits = " << cache_cells[0]
+                              << " of " << lookups << " lookups ("
+                              << (lookups > 0 ? 100.0*cache_cells[0]/lookups : 0.0) << "%), "
+                              << cache_cells[2] << " checked, mass fraction error max = " << cache_err[0]
+                              << ", mean = " << (cache_cells[2] > 0 ? cache_err[1]/cache_cells[2] : 0.0) << "\n";
+                }
+                }
+#ifdef BL_LAZY
+                });
+#endif
 
-            const FArrayBox& uold = react_init ? S_new[mfi] : get_old_data(State_Type)[mfi];
-            FArrayBox& unew       = S_new[mfi];
-            FArrayBox& a          = (*Ap)[mfi];
-            const IArrayBox& m    = (*interior_mask)[mfi];
-            w.resize(bx,1);
-            FArrayBox& I_R        = reactions[mfi];
-            int do_update         = react_init ? 0 : 1;  // TODO: Update here? Or just get reaction source?
+    }
+}
+
+void
+PeleC::react_state_boxes(Real time, Real dt, bool react_init,
+                         const MultiFab& U_old, MultiFab& U_new,
+                         const MultiFab& A, const iMultiFab& mask,
+                         MultiFab& I_R, MultiFab& chem_dt, MultiFab* work,
+                         const MultiFab* cost, int ng,
+                         long& n_integrated, long& n_frozen,
+                         Real& t_busy, Real& t_wall)
+{
+  /*
+    Integrate the chemistry over the boxes of U_new (grown by ng), with the
+    non-reacting forcing A; I_R and, if given, chem_dt (react_warm_start)
+    and the work estimate are updated.  U_old is U_new for react_init.  The cells integrated and those
+    skipped as chemically frozen (pc_react_state) are added to the counters,
+    and the time the threads spent integrating and the wall time of the
+    threaded loop (times the number of threads) to t_busy and t_wall.
+
+    With react_dynamic_schedule, the tiles (react_schedule_tile cells a
+    side) of all the local boxes are put in one list, the most expensive
+    first according to cost over the last step when given, and handed out
+    to the threads one at a time; otherwise each thread gets its own tiles
+    of the MFIter.
+   */
+    BL_PROFILE("PeleC::react_state_boxes()");
+
+    long cells_integrated = 0;
+    long cells_frozen = 0;
+    Real busy = 0.0;
+
+    auto integrate_box = [&] (const Box& bx, int i, FArrayBox& w, long& ni, long& nf)
+    {
+        const FArrayBox& uold = U_old[i];
+        FArrayBox& unew       = U_new[i];
+        const FArrayBox& a    = A[i];
+        const IArrayBox& m    = mask[i];
+        w.resize(bx,1);
+        w.setVal(0.0);  // cells left out by the mask cost nothing
+        FArrayBox& I_R_fab    = I_R[i];
+        // Without chem_dt, an empty box: pc_react_state only reads and
+        // writes dth inside its bounds
+        Real* dth_ptr         = (chem_dt != nullptr) ? (*chem_dt)[i].dataPtr() : I_R_fab.dataPtr();
+        const IntVect dth_lo  = (chem_dt != nullptr) ? (*chem_dt)[i].smallEnd() : bx.smallEnd();
+        const IntVect dth_hi  = (chem_dt != nullptr) ? (*chem_dt)[i].bigEnd() : bx.smallEnd() - IntVect::TheUnitVector();
+        int do_update         = react_init ? 0 : 1;  // TODO: Update here? Or just get reaction source?
+        int tile_integrated   = 0;
+        int tile_frozen       = 0;
 
 #ifdef PELE_USE_EB
-            const EBFArrayBox& ufab = static_cast<const EBFArrayBox&>(unew);
-            const auto& flag_fab = ufab.getEBCellFlagFab();
-            FabType typ = flag_fab.getType(bx);
-            if (typ == FabType::singlevalued || typ == FabType::regular) {
+        const EBFArrayBox& ufab = static_cast<const EBFArrayBox&>(unew);
+        const auto& flag_fab = ufab.getEBCellFlagFab();
+        FabType typ = flag_fab.getType(bx);
+        if (typ == FabType::singlevalued || typ == FabType::regular) {
 #else
-            {
+        {
 #endif
 
-            if(chem_integrator==1)
-            {
-                pc_react_state(ARLIM_3D(bx.loVect()), ARLIM_3D(bx.hiVect()),
-                        uold.dataPtr(),  ARLIM_3D(uold.loVect()),  ARLIM_3D(uold.hiVect()),
-                        unew.dataPtr(),  ARLIM_3D(unew.loVect()),  ARLIM_3D(unew.hiVect()),
-                        a.dataPtr(),     ARLIM_3D(a.loVect()),     ARLIM_3D(a.hiVect()),
-                        m.dataPtr(),     ARLIM_3D(m.loVect()),     ARLIM_3D(m.hiVect()),
-                        w.dataPtr(),     ARLIM_3D(w.loVect()),     ARLIM_3D(w.hiVect()),
-                        I_R.dataPtr(),   ARLIM_3D(I_R.loVect()),   ARLIM_3D(I_R.hiVect()),
+#ifdef USE_SUNDIALS_PP
+        if(chem_integrator==1 && chem_batch_size > 1)
+        {
+            pc_react_state_batched(ARLIM_3D(bx.loVect()), ARLIM_3D(bx.hiVect()),
+                    uold.dataPtr(),  ARLIM_3D(uold.loVect()),  ARLIM_3D(uold.hiVect()),
+                    unew.dataPtr(),  ARLIM_3D(unew.loVect()),  ARLIM_3D(unew.hiVect()),
+                    a.dataPtr(),     ARLIM_3D(a.loVect()),     ARLIM_3D(a.hiVect()),
+                    m.dataPtr(),     ARLIM_3D(m.loVect()),     ARLIM_3D(m.hiVect()),
+                    w.dataPtr(),     ARLIM_3D(w.loVect()),     ARLIM_3D(w.hiVect()),
+                    I_R_fab.dataPtr(), ARLIM_3D(I_R_fab.loVect()), ARLIM_3D(I_R_fab.hiVect()),
 #ifdef PELE_USE_EB
-                        BL_TO_FORTRAN_ANYD(flag_fab),
+                    BL_TO_FORTRAN_ANYD(flag_fab),
 #endif
-                        time, dt, do_update);
-            }
-            else
-            {
+                    time, dt, do_update, chem_batch_size, tile_integrated, tile_frozen);
+        }
+        else
+#endif
+        if(chem_integrator==1 || chem_integrator==3)
+        {
+            pc_react_state(ARLIM_3D(bx.loVect()), ARLIM_3D(bx.hiVect()),
+                    uold.dataPtr(),  ARLIM_3D(uold.loVect()),  ARLIM_3D(uold.hiVect()),
+                    unew.dataPtr(),  ARLIM_3D(unew.loVect()),  ARLIM_3D(unew.hiVect()),
+                    a.dataPtr(),     ARLIM_3D(a.loVect()),     ARLIM_3D(a.hiVect()),
+                    m.dataPtr(),     ARLIM_3D(m.loVect()),     ARLIM_3D(m.hiVect()),
+                    w.dataPtr(),     ARLIM_3D(w.loVect()),     ARLIM_3D(w.hiVect()),
+                    I_R_fab.dataPtr(), ARLIM_3D(I_R_fab.loVect()), ARLIM_3D(I_R_fab.hiVect()),
+                    dth_ptr,         ARLIM_3D(dth_lo.getVect()), ARLIM_3D(dth_hi.getVect()),
+#ifdef PELE_USE_EB
+                    BL_TO_FORTRAN_ANYD(flag_fab),
+#endif
+                    time, dt, do_update, tile_integrated, tile_frozen);
+        }
+        else
+        {
 
-                pc_react_state_expl(ARLIM_3D(bx.loVect()), ARLIM_3D(bx.hiVect()),
-                        uold.dataPtr(),  ARLIM_3D(uold.loVect()),  ARLIM_3D(uold.hiVect()),
-                        unew.dataPtr(),  ARLIM_3D(unew.loVect()),  ARLIM_3D(unew.hiVect()),
-                        a.dataPtr(),     ARLIM_3D(a.loVect()),     ARLIM_3D(a.hiVect()),
-                        m.dataPtr(),     ARLIM_3D(m.loVect()),     ARLIM_3D(m.hiVect()),
-                        w.dataPtr(),     ARLIM_3D(w.loVect()),     ARLIM_3D(w.hiVect()),
-                        I_R.dataPtr(),   ARLIM_3D(I_R.loVect()),   ARLIM_3D(I_R.hiVect()),
-                        time, dt, do_update,adaptrk_nsubsteps_min,adaptrk_nsubsteps_max,adaptrk_nsubsteps_guess,adaptrk_errtol);
-            }
+            pc_react_state_expl(ARLIM_3D(bx.loVect()), ARLIM_3D(bx.hiVect()),
+                    uold.dataPtr(),  ARLIM_3D(uold.loVect()),  ARLIM_3D(uold.hiVect()),
+                    unew.dataPtr(),  ARLIM_3D(unew.loVect()),  ARLIM_3D(unew.hiVect()),
+                    a.dataPtr(),     ARLIM_3D(a.loVect()),     ARLIM_3D(a.hiVect()),
+                    m.dataPtr(),     ARLIM_3D(m.loVect()),     ARLIM_3D(m.hiVect()),
+                    w.dataPtr(),     ARLIM_3D(w.loVect()),     ARLIM_3D(w.hiVect()),
+                    I_R_fab.dataPtr(), ARLIM_3D(I_R_fab.loVect()), ARLIM_3D(I_R_fab.hiVect()),
+                    time, dt, do_update,adaptrk_nsubsteps_min,adaptrk_nsubsteps_max,adaptrk_nsubsteps_guess,adaptrk_errtol);
+        }
+
+
+        ni += tile_integrated;
+        nf += tile_frozen;
+
+        if (work != nullptr)
+        {
+            (*work)[i].plus(w);
+        }
+        }
+    };
+
+    Real wall = ParallelDescriptor::second();
+    int nthreads = 1;
+
+    if (react_dynamic_schedule)
+    {
+        struct ChemItem { int index; Box bx; Real cost; };
+        Vector<ChemItem> items;
+
+        const IntVect tile(AMREX_D_DECL(react_schedule_tile, react_schedule_tile, react_schedule_tile));
+        for (MFIter mfi(U_new, MFItInfo().EnableTiling(tile)); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.growntilebox(ng);
+            const Real c  = (cost != nullptr) ? (*cost)[mfi].sum(bx & mfi.validbox(), 0) : 0.0;
+            items.push_back({mfi.index(), bx, c});
+        }
 
+        // Longest first, so that the last items handed out are short
+        std::stable_sort(items.begin(), items.end(),
+                         [] (const ChemItem& x, const ChemItem& y) { return x.cost > y.cost; });
 
-            if (do_react_load_balance || do_mol_load_balance)
+        const int nitems = items.size();
+
+#ifdef _OPENMP
+#pragma omp parallel reduction(+:cells_integrated,cells_frozen,busy)
+#endif
+        {
+#ifdef _OPENMP
+#pragma omp single
+            nthreads = omp_get_num_threads();
+#endif
+            FArrayBox w;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic,1) nowait
+#endif
+            for (int k = 0; k < nitems; ++k)
             {
-                get_new_data(Work_Estimate_Type)[mfi].plus(w);
+                const Real t0 = ParallelDescriptor::second();
+                integrate_box(items[k].bx, items[k].index, w, cells_integrated, cells_frozen);
+                busy += ParallelDescriptor::second() - t0;
             }
+        }
+    }
+    else
+    {
+#ifdef _OPENMP
+#pragma omp parallel reduction(+:cells_integrated,cells_frozen,busy)
+#endif
+        {
+#ifdef _OPENMP
+#pragma omp single
+            nthreads = omp_get_num_threads();
+#endif
+            FArrayBox w;
+            const Real t0 = ParallelDescriptor::second();
+            for (MFIter mfi(U_new, true); mfi.isValid(); ++mfi)
+            {
+                integrate_box(mfi.growntilebox(ng), mfi.index(), w, cells_integrated, cells_frozen);
             }
+            busy += ParallelDescriptor::second() - t0;
         }
     }
-    if (ng > 0)
-        S_new.FillBoundary(geom.periodicity());
 
-    if (verbose > 1) {
+    wall = ParallelDescriptor::second() - wall;
 
-        const int IOProc   = ParallelDescriptor::IOProcessorNumber();
-        Real      run_time = ParallelDescriptor::second() - strt_time;
+    n_integrated += cells_integrated;
+    n_frozen     += cells_frozen;
+    t_busy       += busy;
+    t_wall       += wall * nthreads;
+}
 
-#ifdef BL_LAZY
-        Lazy::QueueReduction( [=] () mutable {
+void
+PeleC::react_state_redistributed(Real time, Real dt, const MultiFab& A, const iMultiFab& mask,
+                                 int ng, long& n_integrated, long& n_frozen,
+                                 Real& t_busy, Real& t_wall)
+{
+  /*
+    With use_reactions_work_estimate, the chemistry is integrated on the
+    grids of this level distributed by their work estimate over the previous
+    step (knapsack), independently of the hydro DistributionMapping.  The
+    inputs are copied to that layout and the updated state, I_R and work
+    estimate copied back.  The layout is kept while the estimates give the
+    same one; AmrLevel is rebuilt on regrid, so it is never stale.  With
+    do_mol_load_balance, the estimate includes the hydro work.
+   */
+    BL_PROFILE("PeleC::react_state_redistributed()");
+
+    MultiFab& U_old = get_old_data(State_Type);
+    MultiFab& U_new = get_new_data(State_Type);
+    MultiFab& I_R   = get_new_data(Reactions_Type);
+    MultiFab* dth   = chemStepData();
+    MultiFab& work  = get_new_data(Work_Estimate_Type);
+
+    const DistributionMapping dm = DistributionMapping::makeKnapSack(get_old_data(Work_Estimate_Type));
+
+    if (dm == dmap)
+    {
+      // Already balanced for chemistry; no need to move anything
+      react_state_boxes(time, dt, false, U_old, U_new, A, mask, I_R, dth, &work,
+                        &get_old_data(Work_Estimate_Type), ng, n_integrated, n_frozen, t_busy, t_wall);
+      return;
+    }
+
+    if (!(dm == react_dmap))
+    {
+      react_dmap = dm;
+#ifdef PELE_USE_EB
+      react_ebfactory = makeEBFabFactory(geom, grids, react_dmap, {ng, ng, ng}, EBSupport::basic);
 #endif
-                ParallelDescriptor::ReduceRealMax(run_time, IOProc);
+    }
 
-                if (ParallelDescriptor::IOProcessor())
-                std::cout << "PeleC::react_state() time = " << run_time << "\n";
-#ifdef BL_LAZY
-                });
+#ifdef PELE_USE_EB
+    const FabFactory<FArrayBox>& fact = *react_ebfactory;
+#else
+    FArrayBoxFactory fact;
 #endif
 
+    const int nga = A.nGrow();
+    const int ngr = I_R.nGrow();
+
+    MultiFab Uo(grids, react_dmap, NUM_STATE, ng, MFInfo(), fact);
+    MultiFab Un(grids, react_dmap, NUM_STATE, ng, MFInfo(), fact);
+    MultiFab Ac(grids, react_dmap, NUM_STATE, nga, MFInfo(), fact);
+    MultiFab IRc(grids, react_dmap, I_R.nComp(), ngr, MFInfo(), fact);
+    MultiFab Wc(grids, react_dmap, 1, 0, MFInfo(), fact);
+
+    // A ParallelCopy with ghost cells on both sides intersects every grown
+    // source box with every grown destination box, so the ghost cells of
+    // one grid could land on the valid cells of its neighbour.  The grown
+    // boxes are copied first, for the ghost cells at physical and coarse-fine
+    // boundaries (integrated too, see build_interior_boundary_mask), and the
+    // valid cells then overwrite everything they cover.
+    auto copy_grown = [] (MultiFab& dst, const MultiFab& src, int ncomp, int ngc)
+    {
+      dst.ParallelCopy(src, 0, 0, ncomp, ngc, ngc);
+      dst.ParallelCopy(src, 0, 0, ncomp, 0, ngc);
+    };
+
+    copy_grown(Uo, U_old, NUM_STATE, ng);
+    copy_grown(Un, U_new, NUM_STATE, ng);
+    copy_grown(Ac, A, NUM_STATE, nga);
+    IRc.setVal(0.0);
+    copy_grown(IRc, I_R, I_R.nComp(), ngr);  // zero but for react_sdc_reuse cells
+    Wc.setVal(0.0);
+
+    MultiFab Hc;
+    if (dth != nullptr)
+    {
+      Hc.define(grids, react_dmap, 1, 0, MFInfo(), fact);
+      Hc.ParallelCopy(*dth, 0, 0, 1);
+    }
+
+    // Last step's work estimate, for the order of react_dynamic_schedule
+    MultiFab Cc;
+    if (react_dynamic_schedule)
+    {
+      Cc.define(grids, react_dmap, 1, 0, MFInfo(), fact);
+      Cc.ParallelCopy(get_old_data(Work_Estimate_Type), 0, 0, 1);
+    }
+
+    // The ghost cells of the mask only depend on the BoxArray (zero where
+    // covered by a valid cell, as in build_interior_boundary_mask); the valid
+    // cells carry the covered/reuse exclusions and are copied
+    iMultiFab maskc(grids, react_dmap, 1, ng, MFInfo(), DefaultFabFactory<IArrayBox>());
+    maskc.BuildMask(geom.Domain(), geom.periodicity(), 0, 1, 1, 1);
+    maskc.ParallelCopy(mask, 0, 0, 1);
+
+    react_state_boxes(time, dt, false, Uo, Un, Ac, maskc, IRc, (dth != nullptr) ? &Hc : nullptr, &Wc,
+                      react_dynamic_schedule ? &Cc : nullptr, ng, n_integrated, n_frozen, t_busy, t_wall);
+
+    copy_grown(U_new, Un, NUM_STATE, ng);
+    copy_grown(I_R, IRc, I_R.nComp(), ngr);
+    if (dth != nullptr) {
+      dth->ParallelCopy(Hc, 0, 0, 1);
     }
+
+    MultiFab W(grids, dmap, 1, 0, MFInfo(), Factory());
+    W.ParallelCopy(Wc, 0, 0, 1);
+    MultiFab::Add(work, W, 0, 0, 1, 0);
+}
+
+MultiFab*
+PeleC::chemStepData()
+{
+    if (!react_warm_start) {
+        return nullptr;
+    }
+    if (chem_dt.empty())
+    {
+        chem_dt.define(grids, dmap, 1, 0, MFInfo(), Factory());
+        chem_dt.setVal(0.0);
+    }
+    return &chem_dt;
+}
+
+long
+PeleC::mask_covered_cells(iMultiFab& mask)
+{
+  /*
+    Zero the valid cells of mask (on the grids of this level, any
+    distribution) covered by the next finer level; these are overwritten
+    by avgDown at the end of the step.  The covered cells within nGrowTr of
+    an uncovered one are kept: the fine level interpolates its ghost cells
+    from them during the step.  Returns the number of cells zeroed on this
+    rank.
+   */
+    BL_ASSERT(level < parent->finestLevel());
+
+    BoxArray baf = parent->boxArray(level+1);
+    baf.coarsen(parent->refRatio(level));
+
+    long n_masked = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel reduction(+:n_masked)
+#endif
+    for (MFIter mfi(mask); mfi.isValid(); ++mfi)
+    {
+      auto& fab = mask[mfi];
+
+      const std::vector< std::pair<int,Box> >& isects = baf.intersections(mfi.validbox());
+
+      for (int ii = 0; ii < isects.size(); ++ii)
+      {
+        const Box& bx = isects[ii].second;
+
+        // Uncovered cells within reach of bx (outside the domain counts as
+        // uncovered), grown back over the covered cells they see
+        BoxList near = baf.complementIn(amrex::grow(bx, nGrowTr));
+        near.accrete(nGrowTr);
+        if (near.isEmpty())
+        {
+          fab.setVal(0,bx,0);
+          n_masked += bx.numPts();
+          continue;
+        }
+
+        const BoxList deep = BoxArray(near).complementIn(bx);
+        for (const Box& b : deep)
+        {
+          fab.setVal(0,b,0);
+          n_masked += b.numPts();
+        }
+      }
+    }
+
+    return n_masked;
 }
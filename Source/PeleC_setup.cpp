@@ -218,6 +218,15 @@ PeleC::variableSetUp ()
 
     // Get the number of species from the network model.
     get_num_spec(&NumSpec);
+
+#ifdef PELEC_NUM_SPECIES
+    // The hydro kernels were compiled for a fixed species count
+    if (NumSpec != PELEC_NUM_SPECIES) {
+      amrex::Abort("PeleC was built with PELEC_NUM_SPECIES = "
+                   + std::to_string(PELEC_NUM_SPECIES) + " but the chemistry model has "
+                   + std::to_string(NumSpec) + " species");
+    }
+#endif
   
     if (NumSpec > 0)
     {
@@ -17,6 +17,9 @@ PeleC::test_dn() {
   amrex::Print() << "Testing normal derivative calculation for cut cells..." << std::endl;
 
   // Assume we have sv_eb_bndry_geom and sv_eb_bndry_grad_stencil filled. Apply them to field and dump out a list of dphi/dn
+  if (eb_compact_stencils) {
+    amrex::Abort("test_dn applies the dense stencils, released with eb_compact_stencils");
+  }
 
  MultiFab S(grids,dmap,NUM_STATE,NUM_GROW,MFInfo(),Factory());
 
@@ -46,7 +49,7 @@ PeleC::test_dn() {
 
 
     int local_i = mfi.LocalIndex();
-    int Ncut = no_eb_in_domain ? 0 : sv_eb_bndry_grad_stencil[local_i].size();
+    int Ncut = no_eb_in_domain ? 0 : sv_eb_bndry_geom[local_i].size();
 
     int myproc = ParallelDescriptor::MyProc();
 
@@ -22,7 +22,8 @@ contains
                          fx,  fxlo,  fxhi,&
                          V,   Vlo,   Vhi,&
                          D,   Dlo,   Dhi,&
-                         deltax) bind(C, name = "pc_diffterm")
+                         deltax, &
+                         do_vel, do_spec, do_ener) bind(C, name = "pc_diffterm")
 
     use network, only : nspecies
     use meth_params_module, only : NVAR, UMX, UMY, UMZ, UEDEN, UFS, QVAR, QU, QV, QPRES, QTEMP, QFS, QRHO
@@ -57,8 +58,10 @@ contains
     double precision, intent(inout) ::    D(   Dlo(1):   Dhi(1), NVAR)
     double precision, intent(in   ) ::    V(   Vlo(1):   Vhi(1) )
     double precision, intent(in   ) :: deltax(1)
+    integer, intent(in) :: do_vel, do_spec, do_ener
 
     integer :: i, n
+    logical :: need_tau, need_vd, need_h
     double precision :: tauxx, divu
     double precision :: Uface, dudx
     double precision :: pface, hface, Xface, Yface
@@ -70,6 +73,15 @@ contains
     double precision :: dxinv(1)
 
     dxinv = 1.d0/deltax
+
+    ! Only compute what feeds an enabled diffusion class.  The energy flux
+    ! carries viscous work and species enthalpy transport, so it needs both
+    ! the stress and the diffusion velocities.  Components of disabled
+    ! classes are zeroed by the caller.
+    need_tau = (do_vel /= 0) .or. (do_ener /= 0)
+    need_vd  = (do_spec /= 0) .or. (do_ener /= 0)
+    need_h   = (do_ener /= 0)
+
     do i=lo(1)-1,hi(1)+1
        call build(eosi(i))
     enddo
@@ -77,58 +89,66 @@ contains
     gfaci = dxinv(1)
  
     do i=lo(1),hi(1)+1
-       dTdx = gfaci(i) * (Q(i,QTEMP) - Q(i-1,QTEMP))
-       dudx = gfaci(i) * (Q(i,QU)    - Q(i-1,QU))
+       if (need_tau) then
+          dTdx = gfaci(i) * (Q(i,QTEMP) - Q(i-1,QTEMP))
+          dudx = gfaci(i) * (Q(i,QU)    - Q(i-1,QU))
 
-       divu = dudx
-       tauxx = mux(i)*(2.d0*dudx-twoThirds*divu) + xix(i)*divu
-       Uface    = HALF*(Q(i,QU) + Q(i-1,QU))
-       pface    = HALF*(Q(i,QPRES) + Q(i-1,QPRES))
+          divu = dudx
+          tauxx = mux(i)*(2.d0*dudx-twoThirds*divu) + xix(i)*divu
+          Uface    = HALF*(Q(i,QU) + Q(i-1,QU))
 
-       fx(i,UMX)   = - tauxx
-       fx(i,UMY)   = 0.d0
-       fx(i,UMZ)   = 0.d0
-       fx(i,UEDEN) = - tauxx*Uface - lamx(i)*dTdx
+          fx(i,UMX)   = - tauxx
+          fx(i,UMY)   = 0.d0
+          fx(i,UMZ)   = 0.d0
+          fx(i,UEDEN) = - tauxx*Uface - lamx(i)*dTdx
+       end if
 
+       pface    = HALF*(Q(i,QPRES) + Q(i-1,QPRES))
        dlnpi(i) = gfaci(i) * (Q(i,QPRES) - Q(i-1,QPRES)) / pface
     end do
 
-    do i=lo(1)-1,hi(1)+1
-       eosi(i) % massfrac(:) = Q(i,QFS:QFS+nspecies-1)
-       eosi(i) % T           = Q(i,QTEMP)
-       eosi(i) % rho         = Q(i,QRHO)
-       eosi(i) % p           = Q(i,QPRES)
-       call eos_ytx(eosi(i))
-       call eos_hi(eosi(i))
-    end do
-
-    ! Get species/enthalpy diffusion, compute correction velocity
-    Vci = 0.d0
-    do n=1,nspecies
-       do i = lo(1), hi(1)+1
-          Xface = HALF*(eosi(i)%molefrac(n) + eosi(i-1)%molefrac(n))
-          Yface = HALF*(eosi(i)%massfrac(n) + eosi(i-1)%massfrac(n))
-          hface = HALF*(eosi(i)%hi(n)       + eosi(i-1)%hi(n))
-
-          dXdx = gfaci(i) * (eosi(i)%molefrac(n) - eosi(i-1)%molefrac(n))
-          Vd = -Dx(i,n)*(dXdx + (Xface - Yface) * dlnpi(i))
-
-          fx(i,UFS+n-1) = Vd
-          Vci(i) = Vci(i) + Vd
-          fx(i,UEDEN) = fx(i,UEDEN) + Vd*hface
+    if (need_vd) then
+       do i=lo(1)-1,hi(1)+1
+          eosi(i) % massfrac(:) = Q(i,QFS:QFS+nspecies-1)
+          eosi(i) % T           = Q(i,QTEMP)
+          eosi(i) % rho         = Q(i,QRHO)
+          eosi(i) % p           = Q(i,QPRES)
+          call eos_ytx(eosi(i))
+          if (need_h) call eos_hi(eosi(i))
        end do
-    end do
 
-    ! Add correction velocity
-    do n=1,nspecies
-       do i = lo(1), hi(1)+1
-          Yface = HALF*(eosi(i)%massfrac(n) + eosi(i-1)%massfrac(n))
-          hface = HALF*(eosi(i)%hi(n)       + eosi(i-1)%hi(n))
+       ! Get species/enthalpy diffusion, compute correction velocity
+       Vci = 0.d0
+       do n=1,nspecies
+          do i = lo(1), hi(1)+1
+             Xface = HALF*(eosi(i)%molefrac(n) + eosi(i-1)%molefrac(n))
+             Yface = HALF*(eosi(i)%massfrac(n) + eosi(i-1)%massfrac(n))
+
+             dXdx = gfaci(i) * (eosi(i)%molefrac(n) - eosi(i-1)%molefrac(n))
+             Vd = -Dx(i,n)*(dXdx + (Xface - Yface) * dlnpi(i))
+
+             fx(i,UFS+n-1) = Vd
+             Vci(i) = Vci(i) + Vd
+             if (need_h) then
+                hface = HALF*(eosi(i)%hi(n)       + eosi(i-1)%hi(n))
+                fx(i,UEDEN) = fx(i,UEDEN) + Vd*hface
+             end if
+          end do
+       end do
 
-          fx(i,UFS+n-1) = fx(i,UFS+n-1) - Yface*Vci(i)
-          fx(i,UEDEN)   = fx(i,UEDEN)   - Yface*Vci(i)*hface
+       ! Add correction velocity
+       do n=1,nspecies
+          do i = lo(1), hi(1)+1
+             Yface = HALF*(eosi(i)%massfrac(n) + eosi(i-1)%massfrac(n))
+
+             fx(i,UFS+n-1) = fx(i,UFS+n-1) - Yface*Vci(i)
+             if (need_h) then
+                hface = HALF*(eosi(i)%hi(n)       + eosi(i-1)%hi(n))
+                fx(i,UEDEN)   = fx(i,UEDEN)   - Yface*Vci(i)*hface
+             end if
+          end do
        end do
-    end do
+    end if
     
     ! Sscale fluxes by area
     do i=lo(1),hi(1)+1
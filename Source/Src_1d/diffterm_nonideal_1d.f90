@@ -22,7 +22,8 @@ contains
                          fx,  fxlo,  fxhi,&
                          V,   Vlo,   Vhi,&
                          D,   Dlo,   Dhi,&
-                         deltax) bind(C, name = "pc_diffterm")
+                         deltax, &
+                         do_vel, do_spec, do_ener) bind(C, name = "pc_diffterm")
 
     use network, only : nspecies
     use meth_params_module, only : NVAR, UMX, UEDEN, UFS, QVAR, QU, QPRES, QTEMP, QFS, QRHO
@@ -55,8 +56,10 @@ contains
     double precision, intent(inout) ::    D(   Dlo(1):   Dhi(1), NVAR)
     double precision, intent(in   ) ::    V(   Vlo(1):   Vhi(1)  )
     double precision, intent(in   ) :: deltax(1)
+    integer, intent(in) :: do_vel, do_spec, do_ener
 
     integer :: i, n, nn
+    logical :: need_tau, need_vd, need_h
     double precision :: tauxx, dudx, divu
     double precision :: uface, pface, hface, Yface
     double precision :: dTdx, Vd
@@ -68,24 +71,35 @@ contains
     type(eos_t) :: eos_state(lo(1)-1:hi(1)+1)
 
     dxinv = 1.d0/deltax
+
+    ! Only compute what feeds an enabled diffusion class.  The energy flux
+    ! carries viscous work and species enthalpy transport, so it needs both
+    ! the stress and the diffusion velocities.  Components of disabled
+    ! classes are zeroed by the caller.
+    need_tau = (do_vel /= 0) .or. (do_ener /= 0)
+    need_vd  = (do_spec /= 0) .or. (do_ener /= 0)
+    need_h   = (do_ener /= 0)
+
     do i=lo(1)-1,hi(1)+1
        call build(eos_state(i))
     enddo
 
     do i=lo(1),hi(1)+1
-       ! viscous stress
-       dudx = dxinv(1)*(Q(i,QU) - Q(i-1,QU))
-       divu = dudx
-       tauxx = mux(i)*(2.d0*dudx-twoThirds*divu) + xix(i)*divu
-       uface = HALF*(Q(i,QU)    + Q(i-1,QU))
-       pface = HALF*(Q(i,QPRES) + Q(i-1,QPRES))
-
-       fx(i,UMX)   = -tauxx
-       fx(i,UEDEN) = -tauxx*uface
-
-       ! thermal conduction
-       dTdx = dxinv(1) * (Q(i,QTEMP) - Q(i-1,QTEMP))
-       fx(i,UEDEN) = fx(i,UEDEN) - lamx(i)*dTdx
+       if (need_tau) then
+          ! viscous stress
+          dudx = dxinv(1)*(Q(i,QU) - Q(i-1,QU))
+          divu = dudx
+          tauxx = mux(i)*(2.d0*dudx-twoThirds*divu) + xix(i)*divu
+          uface = HALF*(Q(i,QU)    + Q(i-1,QU))
+          pface = HALF*(Q(i,QPRES) + Q(i-1,QPRES))
+
+          fx(i,UMX)   = -tauxx
+          fx(i,UEDEN) = -tauxx*uface
+
+          ! thermal conduction
+          dTdx = dxinv(1) * (Q(i,QTEMP) - Q(i-1,QTEMP))
+          fx(i,UEDEN) = fx(i,UEDEN) - lamx(i)*dTdx
+       end if
 
        ! (1/p)(dp/dx)
    !    dlnp(i) = dxinv(1) * (Q(i,QPRES) - Q(i-1,QPRES)) / pface
@@ -93,77 +107,83 @@ contains
        Vc(i) = 0.d0
     end do
 
-    do i=lo(1)-1,hi(1)+1
-       eos_state(i) % massfrac(:) = Q(i,QFS:QFS+nspecies-1)
-       eos_state(i) % T           = Q(i,QTEMP)
-       eos_state(i) % rho         = Q(i,QRHO)
-       call eos_ytx(eos_state(i))
-       call eos_hi(eos_state(i))
-       call eos_get_transport(eos_state(i))
-    end do
+    if (need_vd) then
+       do i=lo(1)-1,hi(1)+1
+          eos_state(i) % massfrac(:) = Q(i,QFS:QFS+nspecies-1)
+          eos_state(i) % T           = Q(i,QTEMP)
+          eos_state(i) % rho         = Q(i,QRHO)
+          call eos_ytx(eos_state(i))
+          call eos_hi(eos_state(i))
+          call eos_get_transport(eos_state(i))
+       end do
 
-      do n=1,nspecies
-          do i = lo(1), hi(1)+1
+         do n=1,nspecies
+             do i = lo(1), hi(1)+1
 
-             gradY(i,n) = dxinv(1) * (eos_state(i)%massfrac(n) - eos_state(i-1)%massfrac(n))
+                gradY(i,n) = dxinv(1) * (eos_state(i)%massfrac(n) - eos_state(i-1)%massfrac(n))
 
-!    put in P term
-             ddrive(i,n) = 0.5d0*(eos_state(i)% diP(n) + eos_state(i-1)% diP(n)) * gradP(i)
+   !    put in P term
+                ddrive(i,n) = 0.5d0*(eos_state(i)% diP(n) + eos_state(i-1)% diP(n)) * gradP(i)
 
+             enddo
           enddo
-       enddo
 
-       do n=1,nspecies
-       do nn=1,nspecies
-          do i = lo(1), hi(1)+1
+          do n=1,nspecies
+          do nn=1,nspecies
+             do i = lo(1), hi(1)+1
 
-            ddrive(i,n) = ddrive(i,n)+ 0.5d0* (eos_state(i) % dijY(n,nn) &
-                           + eos_state(i-1) % dijY(n,nn)) * gradY(i,nn)
+               ddrive(i,n) = ddrive(i,n)+ 0.5d0* (eos_state(i) % dijY(n,nn) &
+                              + eos_state(i-1) % dijY(n,nn)) * gradY(i,nn)
 
+             enddo
+          enddo
           enddo
-       enddo
-       enddo
 
-       dsum = 0.d0
-       do n=1,nspecies
-          do i = lo(1), hi(1)+1
+          dsum = 0.d0
+          do n=1,nspecies
+             do i = lo(1), hi(1)+1
 
-            dsum(i) = dsum(i) + ddrive(i,n)
+               dsum(i) = dsum(i) + ddrive(i,n)
 
+             enddo
           enddo
-       enddo
-       do n=1,nspecies
-          do i = lo(1), hi(1)+1
+          do n=1,nspecies
+             do i = lo(1), hi(1)+1
 
-            ddrive(i,n) =  ddrive(i,n) - eos_state(i)%massfrac(n) * dsum(i)
+               ddrive(i,n) =  ddrive(i,n) - eos_state(i)%massfrac(n) * dsum(i)
 
+             enddo
           enddo
-       enddo
 
 
-    ! Get species/enthalpy diffusion, compute correction velocity
-    do n=1,nspecies
-       do i = lo(1), hi(1)+1
-          hface = HALF*(eos_state(i)%hi(n)       + eos_state(i-1)%hi(n))
+       ! Get species/enthalpy diffusion, compute correction velocity
+       do n=1,nspecies
+          do i = lo(1), hi(1)+1
 
-          Vd = -Dx(i,n)*ddrive(i,n)
+             Vd = -Dx(i,n)*ddrive(i,n)
 
-          fx(i,UFS+n-1) = Vd
-          Vc(i) = Vc(i) + Vd
-          fx(i,UEDEN) = fx(i,UEDEN) + Vd*hface
+             fx(i,UFS+n-1) = Vd
+             Vc(i) = Vc(i) + Vd
+             if (need_h) then
+                hface = HALF*(eos_state(i)%hi(n)       + eos_state(i-1)%hi(n))
+                fx(i,UEDEN) = fx(i,UEDEN) + Vd*hface
+             end if
+          end do
        end do
-    end do
-
-    ! Add correction velocity
-    do n=1,nspecies
-       do i = lo(1), hi(1)+1
-          Yface = HALF*(eos_state(i)%massfrac(n) + eos_state(i-1)%massfrac(n))
-          hface = HALF*(eos_state(i)%hi(n)       + eos_state(i-1)%hi(n))
 
-          fx(i,UFS+n-1) = fx(i,UFS+n-1) - Yface*Vc(i)
-          fx(i,UEDEN)   = fx(i,UEDEN)   - Yface*Vc(i)*hface
+       ! Add correction velocity
+       do n=1,nspecies
+          do i = lo(1), hi(1)+1
+             Yface = HALF*(eos_state(i)%massfrac(n) + eos_state(i-1)%massfrac(n))
+
+             fx(i,UFS+n-1) = fx(i,UFS+n-1) - Yface*Vc(i)
+             if (need_h) then
+                hface = HALF*(eos_state(i)%hi(n)       + eos_state(i-1)%hi(n))
+                fx(i,UEDEN)   = fx(i,UEDEN)   - Yface*Vc(i)*hface
+             end if
+          end do
        end do
-    end do
+    end if
 
     ! Scale fluxes by area
     do i=lo(1),hi(1)+1
@@ -30,7 +30,8 @@ contains
                          fy,  fylo,  fyhi,&
                          V,   Vlo,   Vhi,&
                          D,   Dlo,   Dhi,&
-                         deltax) bind(C, name = "pc_diffterm")
+                         deltax, &
+                         do_vel, do_spec, do_ener) bind(C, name = "pc_diffterm")
 
     use network, only : nspecies
     use meth_params_module, only : NVAR, UMX, UMY, UMZ, UEDEN, UFS, QVAR, QU, QV, QPRES, QTEMP, QFS, QRHO
@@ -82,8 +83,10 @@ contains
     double precision, intent(inout) ::    D(   Dlo(1):   Dhi(1),   Dlo(2):   Dhi(2), NVAR)
     double precision, intent(in   ) ::    V(   Vlo(1):   Vhi(1),   Vlo(2):   Vhi(2) )
     double precision, intent(in   ) :: deltax(2)
+    integer, intent(in) :: do_vel, do_spec, do_ener
 
     integer :: i, j, k, n
+    logical :: need_tau, need_vd, need_h
     double precision :: tauxx, tauxy, tauyx, tauyy, divu
     double precision :: Uface(2), dudx,dvdx,dudy,dvdy
     double precision :: pface, hface, Xface, Yface
@@ -97,6 +100,15 @@ contains
     double precision :: dxinv(2)
 
     dxinv = 1.d0/deltax
+
+    ! Only compute what feeds an enabled diffusion class.  The energy flux
+    ! carries viscous work and species enthalpy transport, so it needs both
+    ! the stress and the diffusion velocities.  Components of disabled
+    ! classes are zeroed by the caller.
+    need_tau = (do_vel /= 0) .or. (do_ener /= 0)
+    need_vd  = (do_spec /= 0) .or. (do_ener /= 0)
+    need_h   = (do_ener /= 0)
+
     do i=lo(1)-1,hi(1)+1
        call build(eosi(i))
     enddo
@@ -106,63 +118,71 @@ contains
        gfaci = dxinv(1)
        
        do i=lo(1),hi(1)+1
-          dTdx = gfaci(i) * (Q(i,j,QTEMP) - Q(i-1,j,QTEMP))
-          dudx = gfaci(i) * (Q(i,j,QU)    - Q(i-1,j,QU))
-          dvdx = gfaci(i) * (Q(i,j,QV)    - Q(i-1,j,QV))
-          dudy = tx(i,j,1)
-          dvdy = tx(i,j,2)
-
-          divu = dudx + dvdy
-          tauxx = mux(i,j)*(2.d0*dudx-twoThirds*divu) + xix(i,j)*divu
-          tauxy = mux(i,j)*(dudy+dvdx)
-          Uface(1) = HALF*(Q(i,j,QU) + Q(i-1,j,QU))
-          Uface(2) = HALF*(Q(i,j,QV) + Q(i-1,j,QV))
-          pface    = HALF*(Q(i,j,QPRES) + Q(i-1,j,QPRES))
-
-          fx(i,j,UMX)   = - tauxx
-          fx(i,j,UMY)   = - tauxy
-          fx(i,j,UMZ)   = 0.d0
-          fx(i,j,UEDEN) = - tauxx*Uface(1) - tauxy*Uface(2) - lamx(i,j)*dTdx
+          if (need_tau) then
+             dTdx = gfaci(i) * (Q(i,j,QTEMP) - Q(i-1,j,QTEMP))
+             dudx = gfaci(i) * (Q(i,j,QU)    - Q(i-1,j,QU))
+             dvdx = gfaci(i) * (Q(i,j,QV)    - Q(i-1,j,QV))
+             dudy = tx(i,j,1)
+             dvdy = tx(i,j,2)
+
+             divu = dudx + dvdy
+             tauxx = mux(i,j)*(2.d0*dudx-twoThirds*divu) + xix(i,j)*divu
+             tauxy = mux(i,j)*(dudy+dvdx)
+             Uface(1) = HALF*(Q(i,j,QU) + Q(i-1,j,QU))
+             Uface(2) = HALF*(Q(i,j,QV) + Q(i-1,j,QV))
+
+             fx(i,j,UMX)   = - tauxx
+             fx(i,j,UMY)   = - tauxy
+             fx(i,j,UMZ)   = 0.d0
+             fx(i,j,UEDEN) = - tauxx*Uface(1) - tauxy*Uface(2) - lamx(i,j)*dTdx
+          end if
 
+          pface    = HALF*(Q(i,j,QPRES) + Q(i-1,j,QPRES))
           dlnpi(i) = gfaci(i) * (Q(i,j,QPRES) - Q(i-1,j,QPRES)) / pface
        end do
 
-       do i=lo(1)-1,hi(1)+1
-          eosi(i) % massfrac(:) = Q(i,j,QFS:QFS+nspecies-1)
-          eosi(i) % T           = Q(i,j,QTEMP)
-          eosi(i) % rho         = Q(i,j,QRHO)
-          eosi(i) % p           = Q(i,j,QPRES)
-          call eos_ytx(eosi(i))
-          call eos_hi(eosi(i))
-       end do
-
-       ! Get species/enthalpy diffusion, compute correction velocity
-       Vci = 0.d0
-       do n=1,nspecies
-          do i = lo(1), hi(1)+1
-             Xface = HALF*(eosi(i)%molefrac(n) + eosi(i-1)%molefrac(n))
-             Yface = HALF*(eosi(i)%massfrac(n) + eosi(i-1)%massfrac(n))
-             hface = HALF*(eosi(i)%hi(n)       + eosi(i-1)%hi(n))
-
-             dXdx = gfaci(i) * (eosi(i)%molefrac(n) - eosi(i-1)%molefrac(n))
-             Vd = -Dx(i,j,n)*(dXdx + (Xface - Yface) * dlnpi(i))
-
-             fx(i,j,UFS+n-1) = Vd
-             Vci(i) = Vci(i) + Vd
-             fx(i,j,UEDEN) = fx(i,j,UEDEN) + Vd*hface
+       if (need_vd) then
+          do i=lo(1)-1,hi(1)+1
+             eosi(i) % massfrac(:) = Q(i,j,QFS:QFS+nspecies-1)
+             eosi(i) % T           = Q(i,j,QTEMP)
+             eosi(i) % rho         = Q(i,j,QRHO)
+             eosi(i) % p           = Q(i,j,QPRES)
+             call eos_ytx(eosi(i))
+             if (need_h) call eos_hi(eosi(i))
           end do
-       end do
 
-       ! Add correction velocity
-       do n=1,nspecies
-          do i = lo(1), hi(1)+1
-             Yface = HALF*(eosi(i)%massfrac(n) + eosi(i-1)%massfrac(n))
-             hface = HALF*(eosi(i)%hi(n)       + eosi(i-1)%hi(n))
+          ! Get species/enthalpy diffusion, compute correction velocity
+          Vci = 0.d0
+          do n=1,nspecies
+             do i = lo(1), hi(1)+1
+                Xface = HALF*(eosi(i)%molefrac(n) + eosi(i-1)%molefrac(n))
+                Yface = HALF*(eosi(i)%massfrac(n) + eosi(i-1)%massfrac(n))
+
+                dXdx = gfaci(i) * (eosi(i)%molefrac(n) - eosi(i-1)%molefrac(n))
+                Vd = -Dx(i,j,n)*(dXdx + (Xface - Yface) * dlnpi(i))
+
+                fx(i,j,UFS+n-1) = Vd
+                Vci(i) = Vci(i) + Vd
+                if (need_h) then
+                   hface = HALF*(eosi(i)%hi(n)       + eosi(i-1)%hi(n))
+                   fx(i,j,UEDEN) = fx(i,j,UEDEN) + Vd*hface
+                end if
+             end do
+          end do
 
-             fx(i,j,UFS+n-1) = fx(i,j,UFS+n-1) - Yface*Vci(i)
-             fx(i,j,UEDEN)   = fx(i,j,UEDEN)   - Yface*Vci(i)*hface
+          ! Add correction velocity
+          do n=1,nspecies
+             do i = lo(1), hi(1)+1
+                Yface = HALF*(eosi(i)%massfrac(n) + eosi(i-1)%massfrac(n))
+
+                fx(i,j,UFS+n-1) = fx(i,j,UFS+n-1) - Yface*Vci(i)
+                if (need_h) then
+                   hface = HALF*(eosi(i)%hi(n)       + eosi(i-1)%hi(n))
+                   fx(i,j,UEDEN)   = fx(i,j,UEDEN)   - Yface*Vci(i)*hface
+                end if
+             end do
           end do
-       end do
+       end if
     end do
     
     ! Sscale fluxes by area
@@ -189,63 +209,71 @@ contains
        
        do j=lo(2),hi(2)+1
               
-          dTdy = gfacj(j) * (Q(i,j,QTEMP) - Q(i,j-1,QTEMP))
-          dudy = gfacj(j) * (Q(i,j,QU)    - Q(i,j-1,QU))
-          dvdy = gfacj(j) * (Q(i,j,QV)    - Q(i,j-1,QV))
-          dudx = ty(i,j,1)
-          dvdx = ty(i,j,2)
-
-          divu = dudx + dvdy
-          tauyx = muy(i,j)*(dudy+dvdx)
-          tauyy = muy(i,j)*(2.d0*dvdy-twoThirds*divu) + xiy(i,j)*divu
-          Uface(1) = HALF*(Q(i,j,QU) + Q(i,j-1,QU))
-          Uface(2) = HALF*(Q(i,j,QV) + Q(i,j-1,QV))
-          pface    = HALF*(Q(i,j,QPRES) + Q(i,j-1,QPRES))
-
-          fy(i,j,UMX)   = - tauyx
-          fy(i,j,UMY)   = - tauyy
-          fy(i,j,UMZ)   = 0.d0
-          fy(i,j,UEDEN) = - tauyx*Uface(1) - tauyy*Uface(2) - lamy(i,j)*dTdy
+          if (need_tau) then
+             dTdy = gfacj(j) * (Q(i,j,QTEMP) - Q(i,j-1,QTEMP))
+             dudy = gfacj(j) * (Q(i,j,QU)    - Q(i,j-1,QU))
+             dvdy = gfacj(j) * (Q(i,j,QV)    - Q(i,j-1,QV))
+             dudx = ty(i,j,1)
+             dvdx = ty(i,j,2)
+
+             divu = dudx + dvdy
+             tauyx = muy(i,j)*(dudy+dvdx)
+             tauyy = muy(i,j)*(2.d0*dvdy-twoThirds*divu) + xiy(i,j)*divu
+             Uface(1) = HALF*(Q(i,j,QU) + Q(i,j-1,QU))
+             Uface(2) = HALF*(Q(i,j,QV) + Q(i,j-1,QV))
+
+             fy(i,j,UMX)   = - tauyx
+             fy(i,j,UMY)   = - tauyy
+             fy(i,j,UMZ)   = 0.d0
+             fy(i,j,UEDEN) = - tauyx*Uface(1) - tauyy*Uface(2) - lamy(i,j)*dTdy
+          end if
 
+          pface    = HALF*(Q(i,j,QPRES) + Q(i,j-1,QPRES))
           dlnpj(j) = gfacj(j) * (Q(i,j,QPRES) - Q(i,j-1,QPRES)) / pface
        end do
 
-       do j=lo(2)-1,hi(2)+1
-          eosj(j) % massfrac(:) = Q(i,j,QFS:QFS+nspecies-1)
-          eosj(j) % T           = Q(i,j,QTEMP)
-          eosj(j) % rho         = Q(i,j,QRHO)
-          eosj(j) % p           = Q(i,j,QPRES)
-          call eos_ytx(eosj(j))
-          call eos_hi(eosj(j))
-       end do
-
-       ! Get species/enthalpy diffusion, compute correction velocity
-       Vcj = 0.d0
-       do n=1,nspecies
-          do j = lo(2), hi(2)+1
-             Xface = HALF*(eosj(j)%molefrac(n) + eosj(j-1)%molefrac(n))
-             Yface = HALF*(eosj(j)%massfrac(n) + eosj(j-1)%massfrac(n))
-             hface = HALF*(eosj(j)%hi(n)       + eosj(j-1)%hi(n))
-
-             dXdy = gfacj(j) * (eosj(j)%molefrac(n) - eosj(j-1)%molefrac(n))
-             Vd = -Dy(i,j,n)*(dXdy + (Xface - Yface) * dlnpj(j))
-
-             fy(i,j,UFS+n-1) = Vd
-             Vcj(j) = Vcj(j) + Vd
-             fy(i,j,UEDEN) = fy(i,j,UEDEN) + Vd*hface
+       if (need_vd) then
+          do j=lo(2)-1,hi(2)+1
+             eosj(j) % massfrac(:) = Q(i,j,QFS:QFS+nspecies-1)
+             eosj(j) % T           = Q(i,j,QTEMP)
+             eosj(j) % rho         = Q(i,j,QRHO)
+             eosj(j) % p           = Q(i,j,QPRES)
+             call eos_ytx(eosj(j))
+             if (need_h) call eos_hi(eosj(j))
           end do
-       end do
 
-       ! Add correction velocity
-       do n=1,nspecies
-          do j = lo(2), hi(2)+1
-             Yface = HALF*(eosj(j)%massfrac(n) + eosj(j-1)%massfrac(n))
-             hface = HALF*(eosj(j)%hi(n)       + eosj(j-1)%hi(n))
+          ! Get species/enthalpy diffusion, compute correction velocity
+          Vcj = 0.d0
+          do n=1,nspecies
+             do j = lo(2), hi(2)+1
+                Xface = HALF*(eosj(j)%molefrac(n) + eosj(j-1)%molefrac(n))
+                Yface = HALF*(eosj(j)%massfrac(n) + eosj(j-1)%massfrac(n))
+
+                dXdy = gfacj(j) * (eosj(j)%molefrac(n) - eosj(j-1)%molefrac(n))
+                Vd = -Dy(i,j,n)*(dXdy + (Xface - Yface) * dlnpj(j))
+
+                fy(i,j,UFS+n-1) = Vd
+                Vcj(j) = Vcj(j) + Vd
+                if (need_h) then
+                   hface = HALF*(eosj(j)%hi(n)       + eosj(j-1)%hi(n))
+                   fy(i,j,UEDEN) = fy(i,j,UEDEN) + Vd*hface
+                end if
+             end do
+          end do
 
-             fy(i,j,UFS+n-1) = fy(i,j,UFS+n-1) - Yface*Vcj(j)
-             fy(i,j,UEDEN)   = fy(i,j,UEDEN)   - Yface*Vcj(j)*hface
+          ! Add correction velocity
+          do n=1,nspecies
+             do j = lo(2), hi(2)+1
+                Yface = HALF*(eosj(j)%massfrac(n) + eosj(j-1)%massfrac(n))
+
+                fy(i,j,UFS+n-1) = fy(i,j,UFS+n-1) - Yface*Vcj(j)
+                if (need_h) then
+                   hface = HALF*(eosj(j)%hi(n)       + eosj(j-1)%hi(n))
+                   fy(i,j,UEDEN)   = fy(i,j,UEDEN)   - Yface*Vcj(j)*hface
+                end if
+             end do
           end do
-       end do
+       end if
     end do
 
     ! Sscale fluxes by area
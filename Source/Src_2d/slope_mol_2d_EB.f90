@@ -19,7 +19,7 @@ contains
                         ilo1,ilo2,ihi1,ihi2,nv,nva,&
                         domlo,domhi,&
                         qaux, qa_lo, qa_hi, &
-                        flag, fglo, fghi)
+                        flag, fglo, fghi, all_regular)
 
       use amrex_fort_module, only : amrex_real
       use amrex_mempool_module, only : bl_allocate, bl_deallocate
@@ -37,6 +37,7 @@ contains
 
       integer, intent(in) :: fglo(2),fghi(2)
       integer, intent(in) :: flag(fglo(1):fghi(1),fglo(2):fghi(2))
+      logical, intent(in) :: all_regular
 
       double precision :: q(qd_lo(1):qd_hi(1),qd_lo(2):qd_hi(2),nv)
       double precision :: qaux(qa_lo(1):qa_hi(1),qa_lo(2):qa_hi(2),nva)
@@ -49,6 +50,7 @@ contains
       double precision :: slop, dsgn, dlim, dcen
 
       integer :: nbr(-1:1,-1:1)
+      logical :: lft_ok, rgt_ok
 
       if(plm_iorder.eq.1) then
 
@@ -66,9 +68,16 @@ contains
          do j = ilo2, ihi2
             do i = ilo1, ihi1
 
-               call get_neighbor_cells(flag(i,j), nbr)
+               if (all_regular) then
+                  lft_ok = .true.
+                  rgt_ok = .true.
+               else
+                  call get_neighbor_cells(flag(i,j), nbr)
+                  lft_ok = nbr(-1,0).eq.1 .and. .not. is_covered_cell(flag(i,j))
+                  rgt_ok = nbr(1,0).eq.1 .and. .not. is_covered_cell(flag(i,j))
+               endif
 
-               if (nbr(-1,0).eq.1 .and. .not. is_covered_cell(flag(i,j)) ) then
+               if (lft_ok) then
                   dlft(i,1) = 0.5d0*(q(i,j,QPRES)-q(i-1,j,QPRES))/qaux(i,j,QC) - 0.5d0*q(i,j,QRHO)*(q(i,j,QU) - q(i-1,j,QU))
                   dlft(i,2) = 0.5d0*(q(i,j,QPRES)-q(i-1,j,QPRES))/qaux(i,j,QC) + 0.5d0*q(i,j,QRHO)*(q(i,j,QU) - q(i-1,j,QU))
                   dlft(i,3) = q(i,j,QV) - q(i-1,j,QV)
@@ -84,7 +93,7 @@ contains
                   dlft(i,:) = 0.d0
                endif
 
-               if (nbr(1,0).eq.1 .and. .not. is_covered_cell(flag(i,j)) ) then
+               if (rgt_ok) then
                   drgt(i,1) = 0.5d0*(q(i+1,j,QPRES)-q(i,j,QPRES))/qaux(i,j,QC) - 0.5d0*q(i,j,QRHO)*(q(i+1,j,QU) - q(i,j,QU))
                   drgt(i,2) = 0.5d0*(q(i+1,j,QPRES)-q(i,j,QPRES))/qaux(i,j,QC) + 0.5d0*q(i,j,QRHO)*(q(i+1,j,QU) - q(i,j,QU))
                   drgt(i,3) = q(i+1,j,QV) - q(i,j,QV)
@@ -128,7 +137,7 @@ contains
                       ilo1,ilo2,ihi1,ihi2,nv,nva,&
                       domlo,domhi, &
                       qaux, qa_lo, qa_hi, &
-                      flag, fglo, fghi)
+                      flag, fglo, fghi, all_regular)
 
       use amrex_fort_module, only : amrex_real
       use amrex_mempool_module, only : bl_allocate, bl_deallocate
@@ -146,6 +155,7 @@ contains
 
       integer, intent(in) :: fglo(2),fghi(2)
       integer, intent(in) :: flag(fglo(1):fghi(1),fglo(2):fghi(2))
+      logical, intent(in) :: all_regular
 
       double precision :: q(qd_lo(1):qd_hi(1),qd_lo(2):qd_hi(2),nv)
       double precision :: flatn(qd_lo(1):qd_hi(1),qd_lo(2):qd_hi(2))
@@ -158,6 +168,7 @@ contains
       double precision :: slop, dsgn, dlim, dcen
 
       integer ::   nbr(-1:1,-1:1)
+      logical :: lft_ok, rgt_ok
 
       if(plm_iorder.eq.1) then
 
@@ -175,9 +186,16 @@ contains
          do j = ilo2, ihi2
             do i = ilo1, ihi1
 
-               call get_neighbor_cells(flag(i,j), nbr)
+               if (all_regular) then
+                  lft_ok = .true.
+                  rgt_ok = .true.
+               else
+                  call get_neighbor_cells(flag(i,j), nbr)
+                  lft_ok = nbr(0,-1).eq.1 .and. .not. is_covered_cell(flag(i,j))
+                  rgt_ok = nbr(0,1).eq.1 .and. .not. is_covered_cell(flag(i,j))
+               endif
 
-               if (nbr(0,-1).eq.1 .and. .not. is_covered_cell(flag(i,j)) ) then
+               if (lft_ok) then
                   dlft(i,1) = 0.5d0*(q(i,j,QPRES)-q(i,j-1,QPRES))/qaux(i,j,QC) - 0.5d0*q(i,j,QRHO)*(q(i,j,QV) - q(i,j-1,QV))
                   dlft(i,2) = 0.5d0*(q(i,j,QPRES)-q(i,j-1,QPRES))/qaux(i,j,QC) + 0.5d0*q(i,j,QRHO)*(q(i,j,QV) - q(i,j-1,QV))
                   dlft(i,3) = q(i,j,QU) - q(i,j-1,QU)
@@ -193,7 +211,7 @@ contains
                   dlft(i,:) = 0.d0
                endif
 
-               if (nbr(0,1).eq.1 .and. .not. is_covered_cell(flag(i,j)) ) then
+               if (rgt_ok) then
                   drgt(i,1) = 0.5d0*(q(i,j+1,QPRES)-q(i,j,QPRES))/qaux(i,j,QC) - 0.5d0*q(i,j,QRHO)*(q(i,j+1,QV) - q(i,j,QV))
                   drgt(i,2) = 0.5d0*(q(i,j+1,QPRES)-q(i,j,QPRES))/qaux(i,j,QC) + 0.5d0*q(i,j,QRHO)*(q(i,j+1,QV) - q(i,j,QV))
                   drgt(i,3) = q(i,j+1,QU) - q(i,j,QU)
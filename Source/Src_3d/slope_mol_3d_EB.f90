@@ -19,7 +19,7 @@ contains
                         ilo1,ilo2,ilo3,ihi1,ihi2,ihi3,nv,nva,&
                         domlo,domhi,&
                         qaux, qa_lo, qa_hi, &
-                        flag, fglo, fghi)
+                        flag, fglo, fghi, all_regular)
 
       use amrex_fort_module, only : amrex_real
       use amrex_mempool_module, only : bl_allocate, bl_deallocate
@@ -38,6 +38,7 @@ contains
 
       integer, intent(in) :: fglo(3),fghi(3)
       integer, intent(in) :: flag(fglo(1):fghi(1),fglo(2):fghi(2),fglo(3):fghi(3))
+      logical, intent(in) :: all_regular
 
       double precision :: q(qd_lo(1):qd_hi(1),qd_lo(2):qd_hi(2),qd_lo(3):qd_hi(3),nv)
       double precision :: qaux(qa_lo(1):qa_hi(1),qa_lo(2):qa_hi(2),qa_lo(3):qa_hi(3),nva)
@@ -78,11 +79,16 @@ contains
                   enddo
                enddo
 
-               do i = ilo1, ihi1
-                  call get_neighbor_cells( flag(i,j,k), nbr )
-                  flagArrayL(i) = nbr(-1,0,0).eq.1 .and. .not. is_covered_cell(flag(i,j,k))
-                  flagArrayR(i) = nbr(+1,0,0).eq.1 .and. .not. is_covered_cell(flag(i,j,k))
-               enddo
+               if (all_regular) then
+                  flagArrayL = .true.
+                  flagArrayR = .true.
+               else
+                  do i = ilo1, ihi1
+                     call get_neighbor_cells( flag(i,j,k), nbr )
+                     flagArrayL(i) = nbr(-1,0,0).eq.1 .and. .not. is_covered_cell(flag(i,j,k))
+                     flagArrayR(i) = nbr(+1,0,0).eq.1 .and. .not. is_covered_cell(flag(i,j,k))
+                  enddo
+               endif
 
                do i = ilo1, ihi1
                   if (flagArrayL(i)) then
@@ -140,7 +146,7 @@ contains
          ilo1,ilo2,ilo3,ihi1,ihi2,ihi3,nv,nva,&
          domlo,domhi, &
          qaux, qa_lo, qa_hi, &
-         flag, fglo, fghi)
+         flag, fglo, fghi, all_regular)
 
       use amrex_fort_module, only : amrex_real
       use amrex_mempool_module, only : bl_allocate, bl_deallocate
@@ -159,6 +165,7 @@ contains
 
       integer, intent(in) :: fglo(3),fghi(3)
       integer, intent(in) :: flag(fglo(1):fghi(1),fglo(2):fghi(2),fglo(3):fghi(3))
+      logical, intent(in) :: all_regular
 
       double precision :: q(qd_lo(1):qd_hi(1),qd_lo(2):qd_hi(2),qd_lo(3):qd_hi(3),nv)
       double precision :: flatn(qd_lo(1):qd_hi(1),qd_lo(2):qd_hi(2),qd_lo(3):qd_hi(3))
@@ -199,11 +206,16 @@ contains
                   enddo
                enddo
                
-               do i = ilo1, ihi1
-                  call get_neighbor_cells( flag(i,j,k), nbr )
-                  flagArrayL(i) = nbr(0,-1,0).eq.1 .and. .not. is_covered_cell(flag(i,j,k))
-                  flagArrayR(i) = nbr(0,+1,0).eq.1 .and. .not. is_covered_cell(flag(i,j,k))
-               enddo
+               if (all_regular) then
+                  flagArrayL = .true.
+                  flagArrayR = .true.
+               else
+                  do i = ilo1, ihi1
+                     call get_neighbor_cells( flag(i,j,k), nbr )
+                     flagArrayL(i) = nbr(0,-1,0).eq.1 .and. .not. is_covered_cell(flag(i,j,k))
+                     flagArrayR(i) = nbr(0,+1,0).eq.1 .and. .not. is_covered_cell(flag(i,j,k))
+                  enddo
+               endif
 
                do i = ilo1, ihi1
                   if (flagArrayL(i)) then
@@ -262,7 +274,7 @@ contains
          ilo1,ilo2,ilo3,ihi1,ihi2,ihi3,nv,nva, & 
          domlo,domhi, &
          qaux, qa_lo, qa_hi, &
-         flag, fglo, fghi)
+         flag, fglo, fghi, all_regular)
 
       use amrex_fort_module, only : amrex_real
       use amrex_mempool_module, only : bl_allocate, bl_deallocate
@@ -281,6 +293,7 @@ contains
 
       integer, intent(in) :: fglo(3),fghi(3)
       integer, intent(in) :: flag(fglo(1):fghi(1),fglo(2):fghi(2),fglo(3):fghi(3))
+      logical, intent(in) :: all_regular
 
       double precision :: q(qd_lo(1):qd_hi(1),qd_lo(2):qd_hi(2),qd_lo(3):qd_hi(3),nv)
       double precision :: flatn(qd_lo(1):qd_hi(1),qd_lo(2):qd_hi(2),qd_lo(3):qd_hi(3))
@@ -322,11 +335,16 @@ contains
                   enddo
                enddo
                
-               do i = ilo1, ihi1
-                  call get_neighbor_cells( flag(i,j,k), nbr )
-                  flagArrayL(i) = nbr(0,0,-1).eq.1 .and. .not. is_covered_cell(flag(i,j,k))
-                  flagArrayR(i) = nbr(0,0,+1).eq.1 .and. .not. is_covered_cell(flag(i,j,k))
-               enddo
+               if (all_regular) then
+                  flagArrayL = .true.
+                  flagArrayR = .true.
+               else
+                  do i = ilo1, ihi1
+                     call get_neighbor_cells( flag(i,j,k), nbr )
+                     flagArrayL(i) = nbr(0,0,-1).eq.1 .and. .not. is_covered_cell(flag(i,j,k))
+                     flagArrayR(i) = nbr(0,0,+1).eq.1 .and. .not. is_covered_cell(flag(i,j,k))
+                  enddo
+               endif
 
                do i = ilo1, ihi1
                   if (flagArrayL(i)) then
@@ -407,6 +407,57 @@ contains
   end subroutine pc_move_transport_coeffs_to_ec
 
 
+  subroutine pc_transport_state_changed(lo, hi, &
+       q, q_lo, q_hi, &
+       snap, s_lo, s_hi, &
+       tol, changed) &
+       bind(C, name="pc_transport_state_changed")
+
+    ! Compare the state the transport coefficients depend on with the
+    ! snapshot taken when they were last evaluated.  The snapshot holds
+    ! (T, rho, Y_1..Y_nspecies); changed is set to 1 as soon as one cell
+    ! has a relative change in T or rho, or an absolute change in a mass
+    ! fraction, larger than tol.
+
+    use amrex_fort_module, only : amrex_real
+    use network, only : nspecies
+    use meth_params_module, only : QVAR, QTEMP, QRHO, QFS
+
+    implicit none
+
+    integer         , intent(in   ) :: lo(3), hi(3)
+    integer         , intent(in   ) :: q_lo(3), q_hi(3)
+    integer         , intent(in   ) :: s_lo(3), s_hi(3)
+    real (amrex_real), intent(in   ) :: q(q_lo(1):q_hi(1),q_lo(2):q_hi(2),q_lo(3):q_hi(3),QVAR)
+    real (amrex_real), intent(in   ) :: snap(s_lo(1):s_hi(1),s_lo(2):s_hi(2),s_lo(3):s_hi(3),nspecies+2)
+    real (amrex_real), intent(in   ) :: tol
+    integer         , intent(  out) :: changed
+
+    integer :: i, j, k, n
+
+    changed = 0
+
+    do k = lo(3), hi(3)
+       do j = lo(2), hi(2)
+          do i = lo(1), hi(1)
+             if (abs(q(i,j,k,QTEMP) - snap(i,j,k,1)) > tol*abs(snap(i,j,k,1)) .or. &
+                 abs(q(i,j,k,QRHO)  - snap(i,j,k,2)) > tol*abs(snap(i,j,k,2))) then
+                changed = 1
+                return
+             end if
+             do n = 1, nspecies
+                if (abs(q(i,j,k,QFS+n-1) - snap(i,j,k,n+2)) > tol) then
+                   changed = 1
+                   return
+                end if
+             end do
+          end do
+       end do
+    end do
+
+  end subroutine pc_transport_state_changed
+
+
     ! One function for all directions
     subroutine pc_diffterm_aux(lo,  hi,&
                          dmnlo, dmnhi,&
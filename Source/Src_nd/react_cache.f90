@@ -0,0 +1,205 @@
+module react_cache_module
+
+  ! In-situ tabulation of the chemistry solve, in front of react() in
+  ! pc_react_state.  A table entry is keyed by the thermochemical state
+  ! (T, Y, rho) before the solve, quantized with react_cache_dT,
+  ! react_cache_dY and react_cache_drho (relative).  It holds the
+  ! chemical increment of that solve over dt0, the change in (rho Y, T,
+  ! rho e) not due to the non-reacting forcing.  A state falling in the same
+  ! bin, with a dt within dt_ratio_tol of dt0, is mapped to
+  !
+  !    x + dt * forcing + (dt/dt0) * increment
+  !
+  ! instead of being integrated.  The reactor interface gives no
+  ! sensitivities, so the mapping is linear in dt and the forcing only.
+  ! Every react_cache_check_interval-th hit is integrated anyway, and the
+  ! difference from the table gives the error statistics; the entry is then
+  ! refreshed.
+  !
+  ! The table is direct-mapped (a colliding state replaces the entry), has
+  ! a fixed number of entries and is private to each OpenMP thread.
+
+  use amrex_fort_module, only : amrex_real
+  use network, only : nspecies
+
+  implicit none
+
+  private
+  public :: react_cache_init, react_cache_close, react_cache_lookup, &
+            react_cache_apply, react_cache_store, react_cache_stats
+
+  real(amrex_real), parameter :: dt_ratio_tol = 0.2d0
+
+  integer :: cache_size = 0
+  integer,          allocatable :: cache_key(:,:)   ! (nspecies+2, cache_size)
+  logical,          allocatable :: cache_valid(:)
+  real(amrex_real), allocatable :: cache_dt(:)
+  real(amrex_real), allocatable :: cache_inc(:,:)   ! (rho Y, T, rho e) increments
+
+  integer, allocatable :: query_key(:)
+  integer :: hits_since_check = 0
+
+  integer(8)       :: nhit = 0, nmiss = 0, ncheck = 0
+  real(amrex_real) :: err_max = 0.d0, err_sum = 0.d0
+
+  !$omp threadprivate(cache_size, cache_key, cache_valid, cache_dt, cache_inc, &
+  !$omp               query_key, hits_since_check, nhit, nmiss, ncheck, err_max, err_sum)
+
+contains
+
+  !> Allocate this thread's table with nentries entries (0 disables it).
+  subroutine react_cache_init(nentries)
+
+    integer, intent(in) :: nentries
+
+    call react_cache_close()
+
+    cache_size = max(nentries, 0)
+    if (cache_size .eq. 0) return
+
+    allocate(cache_key(nspecies+2, cache_size))
+    allocate(cache_valid(cache_size))
+    allocate(cache_dt(cache_size))
+    allocate(cache_inc(nspecies+2, cache_size))
+    allocate(query_key(nspecies+2))
+    cache_valid = .false.
+
+  end subroutine react_cache_init
+
+  subroutine react_cache_close()
+
+    if (allocated(cache_key)) then
+       deallocate(cache_key, cache_valid, cache_dt, cache_inc, query_key)
+    end if
+    cache_size = 0
+
+  end subroutine react_cache_close
+
+  !> Look up the state (rY = rho Y, T) before the solve; rho e is not part
+  !> of the key, being a function of (T, Y, rho).
+  !> @param[out] slot  table entry for the state, to pass to apply or store
+  !> @param[out] hit   the entry matches the state and dt
+  !> @param[out] check the hit is to be integrated and compared (see store)
+  subroutine react_cache_lookup(rY, dt, slot, hit, check)
+
+    use meth_params_module, only : react_cache_dT, react_cache_dY, react_cache_drho, &
+                                   react_cache_check_interval
+
+    real(amrex_real), intent(in)  :: rY(nspecies+1), dt
+    integer,          intent(out) :: slot
+    logical,          intent(out) :: hit, check
+
+    real(amrex_real) :: rho
+    integer(8)       :: h
+    integer          :: n
+
+    rho = sum(rY(1:nspecies))
+
+    query_key(1) = nint(rY(nspecies+1) / react_cache_dT)
+    query_key(2) = nint(log(rho) / react_cache_drho)
+    do n = 1, nspecies
+       query_key(n+2) = nint(rY(n) / (rho * react_cache_dY))
+    end do
+
+    h = 0
+    do n = 1, nspecies+2
+       h = modulo(h * 1000003_8 + int(query_key(n), 8), 2147483647_8)
+    end do
+    slot = int(modulo(h, int(cache_size, 8))) + 1
+
+    hit = cache_valid(slot)
+    if (hit) hit = all(cache_key(:,slot) .eq. query_key)
+    if (hit) hit = abs(dt / cache_dt(slot) - 1.d0) .le. dt_ratio_tol
+
+    check = .false.
+    if (hit) then
+       nhit = nhit + 1
+       hits_since_check = hits_since_check + 1
+       if (react_cache_check_interval .gt. 0 .and. &
+           hits_since_check .ge. react_cache_check_interval) then
+          check = .true.
+          hits_since_check = 0
+       end if
+    else
+       nmiss = nmiss + 1
+    end if
+
+  end subroutine react_cache_lookup
+
+  !> Map the state with the entry at slot: on input rY and rhoe are the state
+  !> before the solve, on output after it.
+  subroutine react_cache_apply(slot, rY, rhoe, rY_src, rhoe_src, dt)
+
+    integer,          intent(in)    :: slot
+    real(amrex_real), intent(inout) :: rY(nspecies+1), rhoe
+    real(amrex_real), intent(in)    :: rY_src(nspecies), rhoe_src, dt
+
+    real(amrex_real) :: scale
+
+    scale = dt / cache_dt(slot)
+    rY(1:nspecies) = rY(1:nspecies) + dt * rY_src + scale * cache_inc(1:nspecies,slot)
+    rY(nspecies+1) = rY(nspecies+1) + scale * cache_inc(nspecies+1,slot)
+    rhoe           = rhoe + dt * rhoe_src + scale * cache_inc(nspecies+2,slot)
+
+  end subroutine react_cache_apply
+
+  !> Store the result of an integration (rY_out, rhoe_out) of the state
+  !> (rY_in, rhoe_in) at slot.  If the state was a checked hit, the mass
+  !> fractions the table would have given are first compared with it.
+  subroutine react_cache_store(slot, checked, rY_in, rhoe_in, rY_out, rhoe_out, rY_src, rhoe_src, dt)
+
+    integer,          intent(in) :: slot
+    logical,          intent(in) :: checked
+    real(amrex_real), intent(in) :: rY_in(nspecies+1), rhoe_in, rY_out(nspecies+1), rhoe_out
+    real(amrex_real), intent(in) :: rY_src(nspecies), rhoe_src, dt
+
+    real(amrex_real) :: rY_map(nspecies+1), rhoe_map, err
+
+    if (checked) then
+       rY_map   = rY_in
+       rhoe_map = rhoe_in
+       call react_cache_apply(slot, rY_map, rhoe_map, rY_src, rhoe_src, dt)
+       err = maxval(abs(rY_map(1:nspecies) - rY_out(1:nspecies))) / sum(rY_out(1:nspecies))
+       ncheck  = ncheck + 1
+       err_max = max(err_max, err)
+       err_sum = err_sum + err
+    end if
+
+    cache_valid(slot)                 = .true.
+    cache_key(:,slot)                 = query_key
+    cache_dt(slot)                    = dt
+    cache_inc(1:nspecies,slot)        = rY_out(1:nspecies) - rY_in(1:nspecies) - dt * rY_src
+    cache_inc(nspecies+1,slot)        = rY_out(nspecies+1) - rY_in(nspecies+1)
+    cache_inc(nspecies+2,slot)        = rhoe_out - rhoe_in - dt * rhoe_src
+
+  end subroutine react_cache_store
+
+  !> Statistics summed (error: maximum) over the threads since the last
+  !> call, which resets them.
+  subroutine react_cache_stats(hits, misses, checks, max_err, sum_err)
+
+    integer(8),       intent(out) :: hits, misses, checks
+    real(amrex_real), intent(out) :: max_err, sum_err
+
+    hits    = 0
+    misses  = 0
+    checks  = 0
+    max_err = 0.d0
+    sum_err = 0.d0
+
+    !$omp parallel reduction(+:hits,misses,checks,sum_err) reduction(max:max_err)
+    hits    = hits + nhit
+    misses  = misses + nmiss
+    checks  = checks + ncheck
+    max_err = max(max_err, err_max)
+    sum_err = sum_err + err_sum
+    nhit    = 0
+    nmiss   = 0
+    ncheck  = 0
+    err_max = 0.d0
+    err_sum = 0.d0
+    !$omp end parallel
+
+  end subroutine react_cache_stats
+
+end module react_cache_module
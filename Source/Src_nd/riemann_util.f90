@@ -829,17 +829,18 @@ contains
   subroutine riemann_md_vec( rl, ul, vl, v2l, pl, rel, spl, gamcl, &
        rr, ur, vr, v2r, pr, rer, spr, gamcr,&
        qint_iu, vgd, wgd, qint_gdpres, qint_gdgame, &
-       regd, rgd, ustar, gdnv_state, nsp, &
+       regd, rgd, ustar, gdnv_state, &
        uflx_rho, uflx_u, uflx_v, uflx_w, uflx_eden, uflx_eint, &
        bc_test_val, csmall, cav, VECLEN)
 
     use eos_module
     use meth_params_module, only : small_dens, small_pres
+    use species_count_module, only : nsp => nspecies
 
     implicit none
 
     ! Inputs
-    integer, intent(in) :: nsp, VECLEN
+    integer, intent(in) :: VECLEN
     double precision, intent(in), dimension(VECLEN) :: rl, ul, vl, v2l, pl, rel, gamcl 
     double precision, intent(in), dimension(VECLEN) :: rr, ur, vr, v2r, pr, rer,  gamcr ! Right state
     double precision, intent(in), dimension(VECLEN,nsp) :: spl, spr
@@ -1,4 +1,5 @@
 fsources += dvode.f
+fsources += dvwarm.f
 
 fsources += dvhin.f
 fsources += dvindy.f
@@ -21,3 +22,5 @@ fsources += dgbsl.f
 fsources += dgefa.f
 fsources += dgesl.f
 
+f90sources += dvsparse.f90
+
@@ -16,8 +16,8 @@ C               MITER, MSBJ, N, NSLJ
 C     /DVOD02/  NFE, NST, NJE, NLU
 C
 C Subroutines called by DVJAC: F, JAC, DACOPY, DCOPY, DGBFA, DGEFA,
-C                              DSCAL
-C Function routines called by DVJAC: DVNORM
+C                              DSCAL, DVSPFA
+C Function routines called by DVJAC: DVNORM, DVSPAC
 C-----------------------------------------------------------------------
 C DVJAC is called by DVNLSD to compute and process the matrix
 C P = I - h*rl1*J , where J is an approximation to the Jacobian.
@@ -31,6 +31,8 @@ C J is stored in wm and replaced by P.  If MITER .ne. 3, P is then
 C subjected to LU decomposition in preparation for later solution
 C of linear systems with P as coefficient matrix. This is done
 C by DGEFA if MITER = 1 or 2, and by DGBFA if MITER = 4 or 5.
+C If a sparse structure of order N is set (see dvsparse.f90), DVSPFA
+C is used instead of DGEFA (it falls back to DGEFA on a small pivot).
 C
 C Communication with DVJAC is done with the following variables.  (For
 C more details, please see the comments in the driver subroutine.)
@@ -75,6 +77,7 @@ C
 C Type declaration for function subroutines called ---------------------
 C
       DOUBLE PRECISION DVNORM
+      LOGICAL DVSPAC
       PARAMETER(ONE = 1.0D0, THOU = 1000.0D0, ZERO = 0.0D0, PT1 = 0.1D0)
 C
       IERPJ = 0
@@ -142,7 +145,11 @@ C Multiply Jacobian by scalar, add identity, and do LU decomposition. --
         WM(J) = WM(J) + ONE
  250    J = J + NP1
       NLU = NLU + 1
-      CALL DGEFA (WM(3), N, N, IWM(31), IER)
+      IF (DVSPAC(N)) THEN
+        CALL DVSPFA (WM(3), N, N, IWM(31), IER)
+      ELSE
+        CALL DGEFA (WM(3), N, N, IWM(31), IER)
+      ENDIF
       IF (IER .NE. 0) IERPJ = 1
       RETURN
       ENDIF
@@ -1023,6 +1023,12 @@ C-----------------------------------------------------------------------
 C
       include "vode.H"
 C
+C Warm-start step sizes (see DVWSET, DVWGET).
+      DOUBLE PRECISION H0WRM, HUWRM
+      COMMON /DVWARM/ H0WRM, HUWRM
+      SAVE /DVWARM/
+!$omp threadprivate(/DVWARM/)
+C
 C Type declarations for local variables --------------------------------
 C
       EXTERNAL DVNLSD
@@ -1305,6 +1311,9 @@ C Load and invert the EWT array.  (H is temporarily set to 1.0.) -------
       DO 120 I = 1,N
         IF (RWORK(I+LEWT-1) .LE. ZERO) GO TO 621
  120    RWORK(I+LEWT-1) = ONE/RWORK(I+LEWT-1)
+C Use the warm-start step size set with DVWSET, if any. ---------------
+      IF (H0 .EQ. ZERO .AND. H0WRM .GT. ZERO)
+     1   H0 = SIGN(MIN(H0WRM, ABS(TOUT - T)), TOUT - T)
       IF (H0 .NE. ZERO) GO TO 180
 C Call DVHIN to set initial step size H0 to be attempted. --------------
       CALL DVHIN (N, T, RWORK(LYH), RWORK(LF0), F, RPAR, IPAR, TOUT,
@@ -1447,6 +1456,7 @@ C-----------------------------------------------------------------------
       IF (IHIT) T = TCRIT
  420  ISTATE = 2
       RWORK(11) = HU
+      HUWRM = HU
       RWORK(12) = HNEW
       RWORK(13) = TN
       IWORK(11) = NST
@@ -9,12 +9,13 @@ C Call sequence output -- X, IERSL
 C COMMON block variables accessed:
 C     /DVOD01/ -- H, RL1, MITER, N
 C
-C Subroutines called by DVSOL: DGESL, DGBSL
-C Function routines called by DVSOL: None
+C Subroutines called by DVSOL: DGESL, DGBSL, DVSPSL
+C Function routines called by DVSOL: DVSPAC
 C-----------------------------------------------------------------------
 C This routine manages the solution of the linear system arising from
 C a chord iteration.  It is called if MITER .ne. 0.
-C If MITER is 1 or 2, it calls DGESL to accomplish this.
+C If MITER is 1 or 2, it calls DGESL to accomplish this (DVSPSL if a
+C sparse structure of order N is set, see dvsparse.f90).
 C If MITER = 3 it updates the coefficient H*RL1 in the diagonal
 C matrix, and then computes the solution.
 C If MITER is 4 or 5, it calls DGBSL.
@@ -39,12 +40,17 @@ C
 C Type declarations for local variables --------------------------------
 C
       INTEGER I, MEBAND, ML, MU
+      LOGICAL DVSPAC
       DOUBLE PRECISION DI, HRL1, ONE, PHRL1, R, ZERO
       PARAMETER(ONE = 1.0D0, ZERO = 0.0D0)
 C
       IERSL = 0
       GO TO (100, 100, 300, 400, 400), MITER
- 100  CALL DGESL (WM(3), N, N, IWM(31), X, 0)
+ 100  IF (DVSPAC(N)) THEN
+        CALL DVSPSL (WM(3), N, N, IWM(31), X)
+        RETURN
+      ENDIF
+      CALL DGESL (WM(3), N, N, IWM(31), X, 0)
       RETURN
 C
  300  PHRL1 = WM(2)
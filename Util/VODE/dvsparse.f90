@@ -0,0 +1,251 @@
+! Sparse LU of the Newton matrix P = I - h*l0*J for DVODE (MITER = 1 or 2).
+!
+! The matrix stays in the dense (column-major) array of the dense path, but
+! it is factored over the structure of the LU factors of a given sparsity
+! pattern of J, computed once by vode_sparse_init.  The pivots are taken on
+! the diagonal, in a Markowitz order chosen from the structure (fewest
+! (row-1)*(col-1) entries left first) to limit the fill.  P is normally
+! dominated by its diagonal for the steps DVODE takes, but a pivot smaller
+! than sp_pivot_tol times the largest entry below it (threshold pivoting
+! test) sends that factorization to DGEFA, with row pivoting, and the
+! solves with it to DGESL.  For chemistry, where J couples only the species
+! sharing reactions, this replaces the O(n^3) of DGEFA by
+! sum_k |L(:,k)| |U(k,:)|.  The rows of the species of third-body reactions
+! are dense, though, so this only wins for large mechanisms (see
+! Util/benchmarks/vode_sparse_lu.f90).
+!
+! The factors' structure is shared by all threads; set it outside parallel
+! regions.  DVJAC and DVSOL use DVSPFA/DVSPSL instead of DGEFA/DGESL when
+! DVSPAC(N) is true, i.e. a structure of the size of the system is set.
+
+module vode_sparse_module
+
+  implicit none
+
+  private
+
+  public :: vode_sparse_init, vode_sparse_close
+
+  ! Order of the structure (0: none)
+  integer, public, save :: sp_n = 0
+
+  ! k-th pivot piv(k); below it (L) the rows lrow(lptr(k):lptr(k+1)-1), to
+  ! its right (U) the columns ucol(uptr(k):uptr(k+1)-1), of later pivots
+  integer, public, allocatable, save :: piv(:), lptr(:), lrow(:), uptr(:), ucol(:)
+
+  ! Smallest pivot accepted, relative to the largest entry of its L column
+  double precision, public, parameter :: sp_pivot_tol = 0.1d0
+
+  ! Per thread: copy of P for the fallback, and whether the last factorization
+  ! was done by DGEFA (the solves then use DGESL)
+  double precision, public, allocatable, save :: a_save(:,:)
+  logical, public, save :: sp_dense = .false.
+  !$omp threadprivate(a_save, sp_dense)
+
+contains
+
+  !> Set the structure from the pattern of J (pattern(i,j): J(i,j) may be
+  !> nonzero; the diagonal is always included).  nnz_pattern and nnz_lu
+  !> return the entries of the pattern and of L+U.
+  subroutine vode_sparse_init(n, pattern, nnz_pattern, nnz_lu)
+
+    integer, intent(in)  :: n
+    logical, intent(in)  :: pattern(n,n)
+    integer, intent(out) :: nnz_pattern, nnz_lu
+
+    logical, allocatable :: f(:,:), done(:)
+    integer, allocatable :: lrow_tmp(:), ucol_tmp(:)
+    integer :: i, j, k, q, nr, nc
+    integer(8) :: cost, best
+
+    call vode_sparse_close()
+
+    allocate(f(n,n), done(n), piv(n), lptr(n+1), uptr(n+1))
+    allocate(lrow_tmp(n*(n-1)/2+n), ucol_tmp(n*(n-1)/2+n))
+
+    f = pattern
+    do k = 1, n
+       f(k,k) = .true.
+    end do
+    nnz_pattern = count(f)
+
+    done = .false.
+    lptr(1) = 1
+    uptr(1) = 1
+
+    do k = 1, n
+
+       ! Markowitz choice among the remaining diagonal entries
+       best = huge(best)
+       q = 0
+       do i = 1, n
+          if (.not. done(i)) then
+             nr = count(f(i,:) .and. .not. done)
+             nc = count(f(:,i) .and. .not. done)
+             cost = int(nr-1,8) * int(nc-1,8)
+             if (cost .lt. best) then
+                best = cost
+                q = i
+             end if
+          end if
+       end do
+
+       piv(k) = q
+       done(q) = .true.
+
+       ! Its L column and U row, and the fill of eliminating it
+       lptr(k+1) = lptr(k)
+       uptr(k+1) = uptr(k)
+       do i = 1, n
+          if (.not. done(i) .and. f(i,q)) then
+             lrow_tmp(lptr(k+1)) = i
+             lptr(k+1) = lptr(k+1) + 1
+          end if
+          if (.not. done(i) .and. f(q,i)) then
+             ucol_tmp(uptr(k+1)) = i
+             uptr(k+1) = uptr(k+1) + 1
+          end if
+       end do
+       do j = uptr(k), uptr(k+1)-1
+          do i = lptr(k), lptr(k+1)-1
+             f(lrow_tmp(i),ucol_tmp(j)) = .true.
+          end do
+       end do
+
+    end do
+
+    allocate(lrow(max(lptr(n+1)-1,1)), ucol(max(uptr(n+1)-1,1)))
+    lrow = lrow_tmp(1:size(lrow))
+    ucol = ucol_tmp(1:size(ucol))
+
+    nnz_lu = n + (lptr(n+1)-1) + (uptr(n+1)-1)
+
+    sp_n = n
+
+  end subroutine vode_sparse_init
+
+  subroutine vode_sparse_close()
+
+    if (allocated(piv)) deallocate(piv, lptr, lrow, uptr, ucol)
+    sp_n = 0
+
+  end subroutine vode_sparse_close
+
+end module vode_sparse_module
+
+!> Whether DVJAC/DVSOL use the sparse factorization for a system of order n.
+logical function dvspac(n)
+
+  use vode_sparse_module, only : sp_n
+
+  implicit none
+
+  integer, intent(in) :: n
+
+  dvspac = sp_n .gt. 0 .and. n .eq. sp_n
+
+end function dvspac
+
+!> Factor a(lda,n) in place as L U (unit L) over the structure set by
+!> vode_sparse_init, in its pivot order.  If a pivot fails the threshold
+!> test, a is restored and factored by DGEFA into a and ipvt instead.
+!> info as DGEFA: k if the k-th pivot is zero, 0 otherwise.
+subroutine dvspfa(a, lda, n, ipvt, info)
+
+  use vode_sparse_module, only : piv, lptr, lrow, uptr, ucol, &
+                                 sp_pivot_tol, a_save, sp_dense
+
+  implicit none
+
+  integer,          intent(in)    :: lda, n
+  double precision, intent(inout) :: a(lda,n)
+  integer,          intent(out)   :: ipvt(n)
+  integer,          intent(out)   :: info
+
+  integer :: i, j, k, p, q, r
+  double precision :: rpiv, aqj, colmax
+
+  info = 0
+  sp_dense = .false.
+
+  if (allocated(a_save)) then
+     if (size(a_save,1) .ne. n) deallocate(a_save)
+  end if
+  if (.not. allocated(a_save)) allocate(a_save(n,n))
+  a_save = a(1:n,1:n)
+
+  do k = 1, n
+
+     q = piv(k)
+
+     colmax = 0.d0
+     do p = lptr(k), lptr(k+1)-1
+        colmax = max(colmax, abs(a(lrow(p),q)))
+     end do
+     if (abs(a(q,q)) .lt. sp_pivot_tol * colmax .or. a(q,q) .eq. 0.d0) then
+        a(1:n,1:n) = a_save
+        call dgefa(a, lda, n, ipvt, info)
+        sp_dense = .true.
+        return
+     end if
+
+     rpiv = 1.d0 / a(q,q)
+     do p = lptr(k), lptr(k+1)-1
+        a(lrow(p),q) = a(lrow(p),q) * rpiv
+     end do
+
+     do r = uptr(k), uptr(k+1)-1
+        j = ucol(r)
+        aqj = a(q,j)
+        if (aqj .ne. 0.d0) then
+           do p = lptr(k), lptr(k+1)-1
+              i = lrow(p)
+              a(i,j) = a(i,j) - a(i,q) * aqj
+           end do
+        end if
+     end do
+
+  end do
+
+end subroutine dvspfa
+
+!> Solve (L U) x = b with the factors from dvspfa (by DGESL if dvspfa fell
+!> back to DGEFA); b is overwritten by x.
+subroutine dvspsl(a, lda, n, ipvt, b)
+
+  use vode_sparse_module, only : piv, lptr, lrow, uptr, ucol, sp_dense
+
+  implicit none
+
+  integer,          intent(in)    :: lda, n
+  double precision, intent(in)    :: a(lda,n)
+  integer,          intent(in)    :: ipvt(n)
+  double precision, intent(inout) :: b(n)
+
+  integer :: k, p, q
+  double precision :: s
+
+  if (sp_dense) then
+     call dgesl(a, lda, n, ipvt, b, 0)
+     return
+  end if
+
+  do k = 1, n
+     q = piv(k)
+     if (b(q) .ne. 0.d0) then
+        do p = lptr(k), lptr(k+1)-1
+           b(lrow(p)) = b(lrow(p)) - a(lrow(p),q) * b(q)
+        end do
+     end if
+  end do
+
+  do k = n, 1, -1
+     q = piv(k)
+     s = b(q)
+     do p = uptr(k), uptr(k+1)-1
+        s = s - a(q,ucol(p)) * b(ucol(p))
+     end do
+     b(q) = s / a(q,q)
+  end do
+
+end subroutine dvspsl
@@ -0,0 +1,43 @@
+*DECK DVWSET
+      SUBROUTINE DVWSET (H0W)
+C-----------------------------------------------------------------------
+C Warm start for DVODE.  If H0W .GT. 0, a call to DVODE with ISTATE = 1
+C and no H0 given in RWORK(5) attempts a first step of MIN(H0W,|TOUT-T|)
+C (in the direction of TOUT) instead of estimating one with DVHIN.
+C The value holds for later calls until reset with H0W = 0.
+C The block /DVWARM/ appears in DVWSET, DVWGET, DVWDAT and DVODE, and
+C is private to each OpenMP thread.
+C-----------------------------------------------------------------------
+      DOUBLE PRECISION H0W
+      DOUBLE PRECISION H0WRM, HUWRM
+      COMMON /DVWARM/ H0WRM, HUWRM
+      SAVE /DVWARM/
+!$omp threadprivate(/DVWARM/)
+C
+      H0WRM = H0W
+      RETURN
+      END
+*DECK DVWGET
+      SUBROUTINE DVWGET (HUW)
+C-----------------------------------------------------------------------
+C Returns in HUW the step size last used successfully (HU) by the last
+C call to DVODE that returned with ISTATE = 2, to be passed to DVWSET
+C for a later integration from a similar state.
+C-----------------------------------------------------------------------
+      DOUBLE PRECISION HUW
+      DOUBLE PRECISION H0WRM, HUWRM
+      COMMON /DVWARM/ H0WRM, HUWRM
+      SAVE /DVWARM/
+!$omp threadprivate(/DVWARM/)
+C
+      HUW = HUWRM
+      RETURN
+      END
+*DECK DVWDAT
+      BLOCK DATA DVWDAT
+      DOUBLE PRECISION H0WRM, HUWRM
+      COMMON /DVWARM/ H0WRM, HUWRM
+      SAVE /DVWARM/
+!$omp threadprivate(/DVWARM/)
+      DATA H0WRM /0.0D0/, HUWRM /0.0D0/
+      END
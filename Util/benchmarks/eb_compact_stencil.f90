@@ -0,0 +1,634 @@
+!
+! Microbenchmark for the compact EB stencils (pelec.eb_compact_stencils)
+! against the dense 3^D ones, on the cut cells of a sphere.
+!
+! The geometry is that of Exec/Tutorials/EB_Sphere at its finest level
+! (sphere radius 0.5 in a 5.0 domain of 64^3 cells refined 3 times by 2,
+! i.e. a radius of 51.2 cells) in boxes of max_grid_size 16.  Cut cells,
+! normals and boundary centroids come from the level set of the sphere,
+! and the stencils are filled as pc_fill_bndry_grad_stencil and
+! pc_fill_flux_interp_stencil do; the face apertures and centroids are
+! those of the face corners in the fluid, a coarse approximation that
+! keeps their sparsity (fully covered faces give empty stencils).
+!
+! The kernels are copies of the 3D pc_apply_eb_boundry_flux_stencil (one
+! component, the EB heat flux), pc_apply_eb_boundry_visc_flux_stencil and
+! pc_apply_face_stencil (in place, 16 components) and of their compact
+! versions, applied box after box to the same state, so the stencils are
+! streamed from memory and the state mostly stays in cache.
+!
+! Build and run (from this directory):
+!   gfortran -O3 -march=native -cpp -o eb_compact_stencil eb_compact_stencil.f90
+!   ./eb_compact_stencil [radius=51.2]
+! with -DPELEC_EB_STENCIL_FLOAT for float coefficients.
+!
+
+module eb_bench_types
+
+  implicit none
+
+#ifdef PELEC_EB_STENCIL_FLOAT
+  integer, parameter :: sk = 4
+#else
+  integer, parameter :: sk = 8
+#endif
+
+  integer, parameter :: sten_off_i(0:26) = (/ 0,1,2, 0,1,2, 0,1,2, 0,1,2, 0,1,2, 0,1,2, 0,1,2, 0,1,2, 0,1,2 /)
+  integer, parameter :: sten_off_j(0:26) = (/ 0,0,0, 1,1,1, 2,2,2, 0,0,0, 1,1,1, 2,2,2, 0,0,0, 1,1,1, 2,2,2 /)
+  integer, parameter :: sten_off_k(0:26) = (/ 0,0,0, 0,0,0, 0,0,0, 1,1,1, 1,1,1, 1,1,1, 2,2,2, 2,2,2, 2,2,2 /)
+
+  type :: eb_bndry_sten
+     double precision :: val(-1:1,-1:1,-1:1)
+     double precision :: bcval
+     integer          :: iv(0:2)
+     integer          :: iv_base(0:2)
+  end type eb_bndry_sten
+
+  type :: eb_bndry_sten_c
+     double precision :: bcval
+     integer          :: iv(0:2)
+     integer          :: iv_base(0:2)
+     integer          :: start
+     integer          :: nnz
+  end type eb_bndry_sten_c
+
+  type :: face_sten
+     double precision :: val(-1:1,-1:1)
+     integer          :: iv(0:2)
+  end type face_sten
+
+  type :: face_sten_c
+     integer          :: iv(0:2)
+     integer          :: start
+     integer          :: nnz
+  end type face_sten_c
+
+end module eb_bench_types
+
+program eb_compact_stencil
+
+  use eb_bench_types
+
+  implicit none
+
+  integer, parameter :: bs = 16, ng = 5, nc = 16, lo = -ng, hi = bs-1+ng
+  double precision, parameter :: FOUR3RD = 4.d0/3.d0
+
+  double precision :: R, cen(3)
+  integer :: nb, nbox, ib, jb, kb, b, d, L, m, nrep, rep, ncut_tot, nface_tot
+  integer :: blo(3)
+  character(len=32) :: arg
+
+  ! Stencils of all the boxes, one after the other
+  integer, allocatable :: box_lo(:,:), cptr(:), fptr(:,:)
+  type(eb_bndry_sten),   allocatable :: bst(:)
+  type(eb_bndry_sten_c), allocatable :: bstc(:)
+  double precision,      allocatable :: nrm(:,:)
+  type(face_sten),       allocatable :: fst(:,:)
+  type(face_sten_c),     allocatable :: fstc(:,:)
+  real(sk),              allocatable :: bcoef(:), fcoef(:,:)
+  integer(1),            allocatable :: boff(:), foff(:,:)
+  integer :: nbc, nfc(0:2)
+
+  double precision, allocatable :: s(:,:,:,:), Dc(:,:,:), mu(:,:,:), xi(:,:,:)
+  double precision, allocatable :: bcv(:,:), fl_d(:,:), fl_c(:,:), v_d(:,:,:,:), v_c(:,:,:,:)
+  double precision :: t0, t1, tb(2), tv(2), tf(2), err_b, err_v, err_f
+  double precision :: bytes_d, bytes_c
+
+  R = 51.2d0
+  if (command_argument_count() .ge. 1) then
+     call get_command_argument(1, arg)
+     read(arg,*) R
+  end if
+
+  nb  = ceiling((2*R + 8) / bs)
+  cen = 0.5d0 * nb * bs
+
+  ! Count, then fill the cut cells and faces of every box touching the sphere
+  allocate(box_lo(3, nb**3), cptr(0:nb**3), fptr(0:nb**3,0:2))
+  nbox = 0
+  cptr(0) = 0
+  fptr(0,:) = 0
+  do kb = 0, nb-1
+     do jb = 0, nb-1
+        do ib = 0, nb-1
+           blo = (/ ib, jb, kb /) * bs
+           call count_box(blo, ncut_tot, nfc)
+           if (ncut_tot .gt. 0) then
+              nbox = nbox + 1
+              box_lo(:,nbox) = blo
+              cptr(nbox) = cptr(nbox-1) + ncut_tot
+              fptr(nbox,:) = fptr(nbox-1,:) + nfc
+           end if
+        end do
+     end do
+  end do
+
+  allocate(bst(0:cptr(nbox)-1), bstc(0:cptr(nbox)-1), nrm(3,0:cptr(nbox)-1))
+  allocate(fst(0:maxval(fptr(nbox,:))-1,0:2), fstc(0:maxval(fptr(nbox,:))-1,0:2))
+  allocate(bcoef(0:27*cptr(nbox)-1), boff(0:27*cptr(nbox)-1))
+  allocate(fcoef(0:9*maxval(fptr(nbox,:))-1,0:2), foff(0:9*maxval(fptr(nbox,:))-1,0:2))
+
+  nbc = 0
+  nfc = 0
+  do b = 1, nbox
+     call fill_box(box_lo(:,b), cptr(b-1), fptr(b-1,:))
+  end do
+
+  ! State, transport coefficients and boundary values, shared by the boxes
+  allocate(s(lo:hi,lo:hi,lo:hi,nc), Dc(lo:hi,lo:hi,lo:hi), mu(lo:hi,lo:hi,lo:hi), xi(lo:hi,lo:hi,lo:hi))
+  allocate(v_d(lo:hi,lo:hi,lo:hi,nc), v_c(lo:hi,lo:hi,lo:hi,nc))
+  call random_number(s)
+  call random_number(Dc)
+  call random_number(mu)
+  call random_number(xi)
+  m = maxval(cptr(1:nbox) - cptr(0:nbox-1))
+  allocate(bcv(0:m-1,3), fl_d(0:m-1,3), fl_c(0:m-1,3))
+  call random_number(bcv)
+
+  nrep = max(3, int(2.d7 / (27.d0 * nc * cptr(nbox))))
+
+  tb = 0; tv = 0; tf = 0
+  err_b = 0; err_v = 0; err_f = 0
+
+  do rep = 1, nrep
+     do b = 1, nbox
+        L = cptr(b-1)
+        m = cptr(b) - L
+
+        call cpu_time(t0)
+        call flux_dense(bst(L:), m, s, Dc, bcv, fl_d, m, 1)
+        call cpu_time(t1)
+        tb(1) = tb(1) + t1 - t0
+        call flux_compact(bstc(L:), m, bcoef, boff, s, Dc, bcv, fl_c, m, 1)
+        call cpu_time(t0)
+        tb(2) = tb(2) + t0 - t1
+        err_b = max(err_b, maxval(abs(fl_d(0:m-1,1) - fl_c(0:m-1,1))) / maxval(abs(fl_d(0:m-1,1))))
+
+        call cpu_time(t0)
+        call visc_dense(bst(L:), m, nrm(:,L:), s, mu, xi, bcv, fl_d, m)
+        call cpu_time(t1)
+        tv(1) = tv(1) + t1 - t0
+        call visc_compact(bstc(L:), m, bcoef, boff, nrm(:,L:), s, mu, xi, bcv, fl_c, m)
+        call cpu_time(t0)
+        tv(2) = tv(2) + t0 - t1
+        err_v = max(err_v, maxval(abs(fl_d(0:m-1,:) - fl_c(0:m-1,:))) / maxval(abs(fl_d(0:m-1,:))))
+
+        v_d = s
+        v_c = s
+        do d = 0, 2
+           L = fptr(b-1,d)
+           m = fptr(b,d) - L
+           call cpu_time(t0)
+           call face_dense(fst(L:,d), m, d, v_d)
+           call cpu_time(t1)
+           tf(1) = tf(1) + t1 - t0
+           call face_compact(fstc(L:,d), m, fcoef(:,d), foff(:,d), v_c)
+           call cpu_time(t0)
+           tf(2) = tf(2) + t0 - t1
+        end do
+        err_f = max(err_f, maxval(abs(v_d - v_c)))
+     end do
+  end do
+
+  ncut_tot  = cptr(nbox)
+  nface_tot = sum(fptr(nbox,:))
+  bytes_d = storage_size(bst(0))/8.d0 * ncut_tot + storage_size(fst(0,0))/8.d0 * nface_tot
+  bytes_c = storage_size(bstc(0))/8.d0 * ncut_tot + storage_size(fstc(0,0))/8.d0 * nface_tot &
+       + (storage_size(bcoef(0))/8.d0 + 1) * (nbc + sum(nfc))
+
+  write(*,'(a,f6.1,a,i5,a,i8,a,i8)') 'radius ', R, '  boxes ', nbox, '  cut cells ', ncut_tot, &
+       '  cut faces ', nface_tot
+  write(*,'(a,f6.2,a,f6.2)') 'nonzeros per boundary stencil ', dble(nbc)/ncut_tot, &
+       ' (of 27), per face stencil ', dble(sum(nfc))/nface_tot
+  write(*,'(a,f8.2,a,f8.2,a,f5.2)') 'stencil MB: dense ', bytes_d/2**20, '  compact ', bytes_c/2**20, &
+       '  ratio ', bytes_d/bytes_c
+  write(*,'(a24,2a12,a9,a11)') 'kernel (ns per stencil)', 'dense', 'compact', 'speedup', 'max err'
+  write(*,'(a24,2f12.2,f9.2,es11.2)') 'boundary flux (1 comp)', 1.d9*tb/(nrep*ncut_tot), tb(1)/tb(2), err_b
+  write(*,'(a24,2f12.2,f9.2,es11.2)') 'viscous wall flux', 1.d9*tv/(nrep*ncut_tot), tv(1)/tv(2), err_v
+  write(*,'(a24,2f12.2,f9.2,es11.2)') 'face interp (16 comp)', 1.d9*tf/(nrep*nface_tot), tf(1)/tf(2), err_f
+
+contains
+
+  double precision function phi(x)
+    double precision, intent(in) :: x(3)
+    phi = sqrt(sum((x - cen)**2)) - R
+  end function phi
+
+  ! Cut cell: the sphere passes between its corners
+  logical function is_cut(iv)
+    integer, intent(in) :: iv(3)
+    integer :: a, c, e
+    double precision :: p, pmin, pmax
+    pmin = huge(1.d0)
+    pmax = -huge(1.d0)
+    do e = 0, 1
+       do c = 0, 1
+          do a = 0, 1
+             p = phi(dble(iv + (/ a, c, e /)))
+             pmin = min(pmin, p)
+             pmax = max(pmax, p)
+          end do
+       end do
+    end do
+    is_cut = pmin .lt. 0.d0 .and. pmax .gt. 0.d0
+  end function is_cut
+
+  ! Fluid fraction of the corners of the lo face of iv normal to d, and
+  ! their centroid in the two other directions
+  subroutine face_geom(iv, d, fa, fc)
+    integer, intent(in) :: iv(3), d
+    double precision, intent(out) :: fa, fc(2)
+    integer :: a, c, t(2), e(3)
+    t = pack((/ 1, 2, 3 /), (/ 1, 2, 3 /) .ne. d+1)
+    fa = 0
+    fc = 0
+    do c = 0, 1
+       do a = 0, 1
+          e = 0
+          e(t(1)) = a
+          e(t(2)) = c
+          if (phi(dble(iv + e)) .gt. 0.d0) then
+             fa = fa + 0.25d0
+             fc = fc + 0.25d0 * (/ a - 0.5d0, c - 0.5d0 /)
+          end if
+       end do
+    end do
+    if (fa .gt. 0.d0) fc = fc / fa * 0.5d0
+  end subroutine face_geom
+
+  ! Faces of the cut cells of the box, grown by 2, with fluid fraction below 1
+  subroutine box_faces(blo, d, nf, iv_f)
+    integer, intent(in)  :: blo(3), d
+    integer, intent(out) :: nf
+    integer, intent(out), optional :: iv_f(:,:)
+    logical :: mark(-2:bs+2,-2:bs+2,-2:bs+2)
+    integer :: i, j, k, e(3), iv(3)
+    double precision :: fa, fc(2)
+    mark = .false.
+    e = 0
+    e(d+1) = 1
+    do k = -2, bs+1
+       do j = -2, bs+1
+          do i = -2, bs+1
+             if (is_cut(blo + (/ i, j, k /))) then
+                mark(i,j,k) = .true.
+                mark(i+e(1),j+e(2),k+e(3)) = .true.
+             end if
+          end do
+       end do
+    end do
+    nf = 0
+    do k = -2, bs+2
+       do j = -2, bs+2
+          do i = -2, bs+2
+             if (mark(i,j,k)) then
+                iv = (/ i, j, k /)
+                call face_geom(blo + iv, d, fa, fc)
+                if (fa .lt. 1.d0) then
+                   nf = nf + 1
+                   if (present(iv_f)) iv_f(:,nf) = iv
+                end if
+             end if
+          end do
+       end do
+    end do
+  end subroutine box_faces
+
+  subroutine count_box(blo, ncut, nface)
+    integer, intent(in)  :: blo(3)
+    integer, intent(out) :: ncut, nface(0:2)
+    integer :: i, j, k, d
+    ncut = 0
+    do k = -2, bs+1
+       do j = -2, bs+1
+          do i = -2, bs+1
+             if (is_cut(blo + (/ i, j, k /))) ncut = ncut + 1
+          end do
+       end do
+    end do
+    nface = 0
+    if (ncut .gt. 0) then
+       do d = 0, 2
+          call box_faces(blo, d, nface(d))
+       end do
+    end if
+  end subroutine count_box
+
+  ! Dense stencils of the box as pc_fill_bndry_grad_stencil and
+  ! pc_fill_flux_interp_stencil, then their compact copies
+  subroutine fill_box(blo, c0, f0)
+    integer, intent(in) :: blo(3), c0, f0(0:2)
+    integer :: i, j, k, L, d, nf, p, q, e(3), t(2)
+    integer, allocatable :: iv_f(:,:)
+    double precision :: x(3), n(3), bc(3), fa, fc(2), v(27)
+
+    L = c0
+    do k = -2, bs+1
+       do j = -2, bs+1
+          do i = -2, bs+1
+             if (is_cut(blo + (/ i, j, k /))) then
+                x = blo + (/ i, j, k /) + 0.5d0
+                n = (x - cen) / sqrt(sum((x - cen)**2))
+                bc = max(-0.5d0, min(0.5d0, cen + R*n - x))
+                nrm(:,L) = n
+                call fill_grad_stencil((/ i, j, k /), n, bc, bst(L))
+
+                v = reshape(bst(L)%val, (/ 27 /))
+                bstc(L)%bcval   = bst(L)%bcval
+                bstc(L)%iv      = bst(L)%iv
+                bstc(L)%iv_base = bst(L)%iv_base
+                bstc(L)%start   = nbc
+                do p = 1, 27
+                   if (v(p) .ne. 0.d0) then
+                      bcoef(nbc) = real(v(p), sk)
+                      boff(nbc)  = int(p-1, 1)
+                      nbc = nbc + 1
+                   end if
+                end do
+                bstc(L)%nnz = nbc - bstc(L)%start
+                L = L + 1
+             end if
+          end do
+       end do
+    end do
+
+    do d = 0, 2
+       t = pack((/ 1, 2, 3 /), (/ 1, 2, 3 /) .ne. d+1)
+       allocate(iv_f(3, (bs+5)**3))
+       call box_faces(blo, d, nf, iv_f)
+       do q = 1, nf
+          L = f0(d) + q - 1
+          call face_geom(blo + iv_f(:,q), d, fa, fc)
+          fst(L,d)%iv  = iv_f(:,q)
+          fst(L,d)%val = 0.d0
+          i = int(sign(1.d0, fc(1)))
+          j = int(sign(1.d0, fc(2)))
+          fst(L,d)%val(0,0) = fa * (1.d0 - abs(fc(1))) * (1.d0 - abs(fc(2)))
+          fst(L,d)%val(i,0) = fa *        abs(fc(1))   * (1.d0 - abs(fc(2)))
+          fst(L,d)%val(0,j) = fa * (1.d0 - abs(fc(1))) *        abs(fc(2))
+          fst(L,d)%val(i,j) = fa *        abs(fc(1))   *        abs(fc(2))
+
+          fstc(L,d)%iv    = fst(L,d)%iv
+          fstc(L,d)%start = nfc(d)
+          do p = 0, 8
+             e = 0
+             e(t(1)) = mod(p,3) - 1
+             e(t(2)) = p/3 - 1
+             if (fst(L,d)%val(mod(p,3)-1, p/3-1) .ne. 0.d0) then
+                fcoef(nfc(d),d) = real(fst(L,d)%val(mod(p,3)-1, p/3-1), sk)
+                foff(nfc(d),d)  = int((e(1)+1) + 3*(e(2)+1) + 9*(e(3)+1), 1)
+                nfc(d) = nfc(d) + 1
+             end if
+          end do
+          fstc(L,d)%nnz = nfc(d) - fstc(L,d)%start
+       end do
+       deallocate(iv_f)
+    end do
+  end subroutine fill_box
+
+  ! As pc_fill_bndry_grad_stencil (3D), with dx = 1 and unit eb_area
+  subroutine fill_grad_stencil(ivs, n, bcent, st)
+    integer, intent(in) :: ivs(3)
+    double precision, intent(in) :: n(3), bcent(3)
+    type(eb_bndry_sten), intent(out) :: st
+    integer :: c(3), sg(3), iv(3), sh(3), baseiv(3), m, ii, jj, kk
+    logical :: mask(3)
+    integer :: imax(1)
+    double precision :: bb(3), x(2), y(2), z(2), dd(2), sten(-1:1,-1:1,-1:1), tsten(-1:1,-1:1,-1:1)
+    double precision :: cy(-1:1), cz(-1:1)
+
+    mask = .true.
+    do m = 1, 3
+       imax = maxloc(abs(n), mask)
+       c(m) = imax(1)
+       mask(imax(1)) = .false.
+    end do
+    sg = int(sign(1.d0, n(c)))
+    bb = bcent(c) * sg
+    baseiv = ivs + int(sign(1.d0, n)) - 1
+
+    x = (/ 1.d0, 2.d0 /)
+    y = bb(2) + (x - bb(1))*abs(n(c(2))/n(c(1)))
+    z = bb(3) + (x - bb(1))*abs(n(c(3))/n(c(1)))
+    sh = 0
+    if (y(1) < 0 .or. y(2) < 0) then
+       sh(c(2)) = -sg(2)
+       bb(2) = bb(2) + 1
+       y = bb(2) + (x - bb(1))*abs(n(c(2))/n(c(1)))
+    end if
+    if (z(1) < 0 .or. z(2) < 0) then
+       sh(c(3)) = -sg(3)
+       bb(3) = bb(3) + 1
+       z = bb(3) + (x - bb(1))*abs(n(c(3))/n(c(1)))
+    end if
+    dd = sqrt((x - bb(1))**2 + (y - bb(2))**2 + (z - bb(3))**2)
+
+    sten = 0
+    do m = 1, 2
+       cy(-1) = 0.5d0*(y(m)-1)*(y(m)-2)
+       cy( 0) =      -y(m)    *(y(m)-2)
+       cy( 1) = 0.5d0* y(m)   *(y(m)-1)
+       cz(-1) = 0.5d0*(z(m)-1)*(z(m)-2)
+       cz( 0) =      -z(m)    *(z(m)-2)
+       cz( 1) = 0.5d0* z(m)   *(z(m)-1)
+       do kk = -1, 1
+          do jj = -1, 1
+             sten(m-1,jj,kk) = cy(jj)*cz(kk)
+          end do
+       end do
+    end do
+    sten(0,:,:) = sten(0,:,:) * dd(2)/(dd(1)*(dd(2)-dd(1)))
+    sten(1,:,:) = sten(1,:,:) * dd(1)/(dd(2)*(dd(1)-dd(2)))
+
+    do kk = -1, 1
+       do jj = -1, 1
+          do ii = -1, 1
+             iv(c(1)) = (ii+1) * sg(1) + ivs(c(1)) - baseiv(c(1)) - 1
+             iv(c(2)) = (jj+1) * sg(2) + ivs(c(2)) - baseiv(c(2)) - 1
+             iv(c(3)) = (kk+1) * sg(3) + ivs(c(3)) - baseiv(c(3)) - 1
+             tsten(iv(1),iv(2),iv(3)) = sten(ii,jj,kk)
+          end do
+       end do
+    end do
+
+    st%iv      = ivs
+    st%iv_base = baseiv + sh
+    st%bcval   = - (dd(1)+dd(2))/(dd(1)*dd(2))
+    st%val     = tsten
+  end subroutine fill_grad_stencil
+
+  subroutine flux_dense(sten, Nsten, s, D, bcval, bcflux, Nflux, ncomp)
+    integer, intent(in) :: Nsten, Nflux, ncomp
+    type(eb_bndry_sten), intent(in) :: sten(0:Nsten-1)
+    double precision, intent(in) :: s(lo:hi,lo:hi,lo:hi,nc), D(lo:hi,lo:hi,lo:hi), bcval(0:Nflux-1,3)
+    double precision, intent(inout) :: bcflux(0:Nflux-1,3)
+    integer :: L, n, i, j, k, ii, jj, kk
+    do L = 0, Nsten-1
+       i = sten(L)%iv(0); j = sten(L)%iv(1); k = sten(L)%iv(2)
+       ii = sten(L)%iv_base(0); jj = sten(L)%iv_base(1); kk = sten(L)%iv_base(2)
+       do n = 1, ncomp
+          bcflux(L,n) = D(i,j,k) * (bcval(L,n) * sten(L)%bcval + &
+               sum(sten(L)%val(-1:1,-1:1,-1:1) * s(ii:ii+2,jj:jj+2,kk:kk+2,n)))
+       end do
+    end do
+  end subroutine flux_dense
+
+  subroutine flux_compact(sten, Nsten, coef, off, s, D, bcval, bcflux, Nflux, ncomp)
+    integer, intent(in) :: Nsten, Nflux, ncomp
+    type(eb_bndry_sten_c), intent(in) :: sten(0:Nsten-1)
+    real(sk), intent(in) :: coef(0:*)
+    integer(1), intent(in) :: off(0:*)
+    double precision, intent(in) :: s(lo:hi,lo:hi,lo:hi,nc), D(lo:hi,lo:hi,lo:hi), bcval(0:Nflux-1,3)
+    double precision, intent(inout) :: bcflux(0:Nflux-1,3)
+    integer :: L, n, i, j, k, ii, jj, kk, p, o
+    double precision :: dsdn
+    do L = 0, Nsten-1
+       i = sten(L)%iv(0); j = sten(L)%iv(1); k = sten(L)%iv(2)
+       ii = sten(L)%iv_base(0); jj = sten(L)%iv_base(1); kk = sten(L)%iv_base(2)
+       do n = 1, ncomp
+          dsdn = 0.d0
+          do p = sten(L)%start, sten(L)%start + sten(L)%nnz - 1
+             o = off(p)
+             dsdn = dsdn + coef(p) * s(ii+sten_off_i(o),jj+sten_off_j(o),kk+sten_off_k(o),n)
+          end do
+          bcflux(L,n) = D(i,j,k) * (bcval(L,n) * sten(L)%bcval + dsdn)
+       end do
+    end do
+  end subroutine flux_compact
+
+  subroutine wall_frame(n, Qt)
+    double precision, intent(in) :: n(3)
+    double precision, intent(out) :: Qt(3,3)
+    double precision :: alpha(3), t1(3), t2(3)
+    alpha = 0.d0
+    alpha(minloc(abs(n))) = 1.d0
+    t1 = alpha - dot_product(n, alpha)*n
+    t1 = t1 / sqrt(sum(t1**2))
+    t2 = (/ n(2)*t1(3) - n(3)*t1(2), n(3)*t1(1) - n(1)*t1(3), n(1)*t1(2) - n(2)*t1(1) /)
+    Qt(1,:) = n
+    Qt(2,:) = t1
+    Qt(3,:) = t2
+  end subroutine wall_frame
+
+  subroutine visc_dense(sten, Nsten, nrm, s, mu, xi, bcval, bcflux, Nflux)
+    integer, intent(in) :: Nsten, Nflux
+    type(eb_bndry_sten), intent(in) :: sten(0:Nsten-1)
+    double precision, intent(in) :: nrm(3,0:Nsten-1)
+    double precision, intent(in) :: s(lo:hi,lo:hi,lo:hi,nc), mu(lo:hi,lo:hi,lo:hi), xi(lo:hi,lo:hi,lo:hi)
+    double precision, intent(in) :: bcval(0:Nflux-1,3)
+    double precision, intent(inout) :: bcflux(0:Nflux-1,3)
+    integer :: L, M, i, j, k, ii, jj, kk, iii, jjj, kkk
+    double precision :: Qt(3,3), Uo(-1:1,-1:1,-1:1,3), Ut(-1:1,-1:1,-1:1,3), dUtdn(3), tauDotN(3), bct(3)
+    do L = 0, Nsten-1
+       i = sten(L)%iv(0); j = sten(L)%iv(1); k = sten(L)%iv(2)
+       ii = sten(L)%iv_base(0); jj = sten(L)%iv_base(1); kk = sten(L)%iv_base(2)
+       call wall_frame(nrm(:,L), Qt)
+       Uo = s(ii:ii+2,jj:jj+2,kk:kk+2,1:3)
+       do kkk = -1, 1
+          do jjj = -1, 1
+             do iii = -1, 1
+                do M = 1, 3
+                   Ut(iii,jjj,kkk,M) = Qt(M,1) * Uo(iii,jjj,kkk,1) &
+                        +              Qt(M,2) * Uo(iii,jjj,kkk,2) &
+                        +              Qt(M,3) * Uo(iii,jjj,kkk,3)
+                end do
+             end do
+          end do
+       end do
+       bct = matmul(Qt, bcval(L,:))
+       do M = 1, 3
+          dUtdn(M) = sum(sten(L)%val * Ut(:,:,:,M)) + bct(M) * sten(L)%bcval
+       end do
+       tauDotN(1) = (FOUR3RD*mu(i,j,k) + xi(i,j,k)) * dUtdn(1)
+       tauDotN(2:3) = mu(i,j,k) * dUtdn(2:3)
+       bcflux(L,:) = matmul(transpose(Qt), tauDotN)
+    end do
+  end subroutine visc_dense
+
+  subroutine visc_compact(sten, Nsten, coef, off, nrm, s, mu, xi, bcval, bcflux, Nflux)
+    integer, intent(in) :: Nsten, Nflux
+    type(eb_bndry_sten_c), intent(in) :: sten(0:Nsten-1)
+    real(sk), intent(in) :: coef(0:*)
+    integer(1), intent(in) :: off(0:*)
+    double precision, intent(in) :: nrm(3,0:Nsten-1)
+    double precision, intent(in) :: s(lo:hi,lo:hi,lo:hi,nc), mu(lo:hi,lo:hi,lo:hi), xi(lo:hi,lo:hi,lo:hi)
+    double precision, intent(in) :: bcval(0:Nflux-1,3)
+    double precision, intent(inout) :: bcflux(0:Nflux-1,3)
+    integer :: L, M, i, j, k, ii, jj, kk, iii, jjj, kkk, p, o
+    double precision :: Qt(3,3), dUtdn(3), tauDotN(3), bct(3)
+    do L = 0, Nsten-1
+       i = sten(L)%iv(0); j = sten(L)%iv(1); k = sten(L)%iv(2)
+       ii = sten(L)%iv_base(0); jj = sten(L)%iv_base(1); kk = sten(L)%iv_base(2)
+       call wall_frame(nrm(:,L), Qt)
+       bct = matmul(Qt, bcval(L,:))
+       dUtdn = 0.d0
+       do p = sten(L)%start, sten(L)%start + sten(L)%nnz - 1
+          o = off(p)
+          iii = ii + sten_off_i(o)
+          jjj = jj + sten_off_j(o)
+          kkk = kk + sten_off_k(o)
+          do M = 1, 3
+             dUtdn(M) = dUtdn(M) + coef(p) * (Qt(M,1) * s(iii,jjj,kkk,1) &
+                  +                           Qt(M,2) * s(iii,jjj,kkk,2) &
+                  +                           Qt(M,3) * s(iii,jjj,kkk,3))
+          end do
+       end do
+       dUtdn = dUtdn + bct * sten(L)%bcval
+       tauDotN(1) = (FOUR3RD*mu(i,j,k) + xi(i,j,k)) * dUtdn(1)
+       tauDotN(2:3) = mu(i,j,k) * dUtdn(2:3)
+       bcflux(L,:) = matmul(transpose(Qt), tauDotN)
+    end do
+  end subroutine visc_compact
+
+  subroutine face_dense(sten, Nsten, idir, v)
+    integer, intent(in) :: Nsten, idir
+    type(face_sten), intent(in) :: sten(0:Nsten-1)
+    double precision, intent(inout) :: v(lo:hi,lo:hi,lo:hi,nc)
+    double precision :: newval(0:Nsten-1)
+    integer :: L, n, i, j, k
+    do n = 1, nc
+       do L = 0, Nsten-1
+          i = sten(L)%iv(0); j = sten(L)%iv(1); k = sten(L)%iv(2)
+          if (idir .eq. 0) then
+             newval(L) = sum(sten(L)%val * v(i,j-1:j+1,k-1:k+1,n))
+          else if (idir .eq. 1) then
+             newval(L) = sum(sten(L)%val * v(i-1:i+1,j,k-1:k+1,n))
+          else
+             newval(L) = sum(sten(L)%val * v(i-1:i+1,j-1:j+1,k,n))
+          end if
+       end do
+       do L = 0, Nsten-1
+          v(sten(L)%iv(0),sten(L)%iv(1),sten(L)%iv(2),n) = newval(L)
+       end do
+    end do
+  end subroutine face_dense
+
+  subroutine face_compact(sten, Nsten, coef, off, v)
+    integer, intent(in) :: Nsten
+    type(face_sten_c), intent(in) :: sten(0:Nsten-1)
+    real(sk), intent(in) :: coef(0:*)
+    integer(1), intent(in) :: off(0:*)
+    double precision, intent(inout) :: v(lo:hi,lo:hi,lo:hi,nc)
+    double precision :: newval(nc,0:Nsten-1), cf
+    integer :: L, n, i, j, k, p, o, ii, jj, kk
+    do L = 0, Nsten-1
+       i = sten(L)%iv(0); j = sten(L)%iv(1); k = sten(L)%iv(2)
+       newval(:,L) = 0.d0
+       do p = sten(L)%start, sten(L)%start + sten(L)%nnz - 1
+          o = off(p)
+          cf = coef(p)
+          ii = i + sten_off_i(o) - 1
+          jj = j + sten_off_j(o) - 1
+          kk = k + sten_off_k(o) - 1
+          do n = 1, nc
+             newval(n,L) = newval(n,L) + cf * v(ii,jj,kk,n)
+          end do
+       end do
+    end do
+    do L = 0, Nsten-1
+       v(sten(L)%iv(0),sten(L)%iv(1),sten(L)%iv(2),:) = newval(:,L)
+    end do
+  end subroutine face_compact
+
+end program eb_compact_stencil
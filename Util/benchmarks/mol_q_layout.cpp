@@ -0,0 +1,191 @@
+//
+// Microbenchmark for the layout of the MOL primitive state (Qfab).
+//
+// Qfab stores its components as the slowest index, so the components of one
+// cell are one "component stride" (the number of cells of the fab) apart.
+// For the usual grown tiles (e.g. 16^3 tiles grown by 4 cells, 24^3) that
+// stride is a multiple of 4 KiB and every component of a cell maps to the
+// same L1 set; per-cell species gathers (EOS, transport) and stencils that
+// touch many components then suffer conflict misses once more than the L1
+// associativity worth of components is in flight.
+//
+// Three layouts are compared:
+//   plain       components slowest, fab over the grown tile (current default)
+//   padded      components slowest, fab box grown to odd lengths
+//               (pelec.mol_pad_q = 1)
+//   interleaved species fastest, one cell after the other (reference only)
+//
+// on two access patterns of the MOL kernels:
+//   gather  per-cell sum over all species        (EOS / transport calls)
+//   pencil  unit-stride i-loop over every component with a j-neighbour
+//           stencil                               (slopes, diffusion fluxes)
+//
+// L1 misses are counted with a simulated 48 KiB, 12-way, 64 B line LRU cache
+// (override with L1_KB / L1_WAYS), so the numbers are reproducible without
+// hardware counters.  Wall-clock times are reported as well.
+//
+// Build and run:
+//   g++ -O3 -march=native -o mol_q_layout mol_q_layout.cpp
+//   ./mol_q_layout [nspecies=9] [tile=16] [ngrow=4]
+//
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+
+struct Cache
+{
+    int nsets, ways;
+    std::vector<std::uintptr_t> tag;
+    std::vector<std::uint64_t> stamp;
+    std::uint64_t clock = 0, accesses = 0, misses = 0;
+
+    Cache (int kb, int w) : nsets(kb*1024/64/w), ways(w),
+                            tag(nsets*w, ~std::uintptr_t(0)), stamp(nsets*w, 0) {}
+
+    void touch (const void* p)
+    {
+        const std::uintptr_t line = reinterpret_cast<std::uintptr_t>(p) / 64;
+        const int set = line % nsets;
+        ++accesses;
+        ++clock;
+        int victim = set*ways;
+        for (int w = set*ways; w < (set+1)*ways; ++w) {
+            if (tag[w] == line) { stamp[w] = clock; return; }
+            if (stamp[w] < stamp[victim]) victim = w;
+        }
+        ++misses;
+        tag[victim] = line;
+        stamp[victim] = clock;
+    }
+};
+
+struct NoCache { void touch (const void*) {} };
+
+struct Layout
+{
+    const char* name;
+    int nx, ny, nz;      // allocated lengths
+    int ncomp;
+    bool interleaved;
+    std::vector<double> data;
+
+    Layout (const char* nm, int n, int pad, int nc, bool il)
+        : name(nm), nx(n+pad), ny(n+pad), nz(n+pad), ncomp(nc), interleaved(il),
+          data(std::size_t(nx)*ny*nz*nc)
+    {
+        for (std::size_t m = 0; m < data.size(); ++m) data[m] = 1.0 + 1.e-3*(m % 97);
+    }
+
+    double* at (int i, int j, int k, int n)
+    {
+        const std::size_t cell = i + std::size_t(nx)*(j + std::size_t(ny)*k);
+        return interleaved ? &data[cell*ncomp + n]
+                           : &data[cell + std::size_t(nx)*ny*nz*n];
+    }
+};
+
+// Per-cell gather over the species block, as done when filling eos_t%massfrac
+template <class C>
+double gather (Layout& q, int n, int qfs, int nspec, C& cache)
+{
+    double s = 0;
+    for (int k = 0; k < n; ++k)
+    for (int j = 0; j < n; ++j)
+    for (int i = 0; i < n; ++i) {
+        double y = 0;
+        for (int m = 0; m < nspec; ++m) {
+            const double* p = q.at(i,j,k,qfs+m);
+            cache.touch(p);
+            y += *p * (m+1);
+        }
+        s += y;
+    }
+    return s;
+}
+
+// Unit-stride pencil stencil over every component, as in the slope and
+// diffusion flux loops
+template <class C>
+double pencil (Layout& q, int n, C& cache)
+{
+    double s = 0;
+    for (int k = 0; k < n; ++k)
+    for (int j = 1; j < n-1; ++j)
+    for (int i = 0; i < n; ++i) {
+        double d = 0;
+        for (int m = 0; m < q.ncomp; ++m) {
+            const double* pm = q.at(i,j-1,k,m);
+            const double* pp = q.at(i,j+1,k,m);
+            cache.touch(pm);
+            cache.touch(pp);
+            d += *pp - *pm;
+        }
+        s += d;
+    }
+    return s;
+}
+
+template <class F>
+double seconds (F&& f, int reps)
+{
+    auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < reps; ++r) f();
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(t1-t0).count() / reps;
+}
+
+}
+
+int main (int argc, char* argv[])
+{
+    const int nspec = argc > 1 ? std::atoi(argv[1]) : 9;
+    const int tile  = argc > 2 ? std::atoi(argv[2]) : 16;
+    const int ngrow = argc > 3 ? std::atoi(argv[3]) : 4;
+    const int l1_kb   = std::getenv("L1_KB")   ? std::atoi(std::getenv("L1_KB"))   : 48;
+    const int l1_ways = std::getenv("L1_WAYS") ? std::atoi(std::getenv("L1_WAYS")) : 12;
+
+    // rho, u, v, w, game, p, reint, T, species
+    const int qfs = 8;
+    const int ncomp = qfs + nspec;
+    const int n = tile + 2*ngrow;
+    const int pad = (n % 2 == 0) ? 1 : 0;
+
+    std::printf("grown tile %d^3, %d components (%d species), simulated L1 %d KiB %d-way\n",
+                n, ncomp, nspec, l1_kb, l1_ways);
+    std::printf("%-12s %-7s %12s %12s %10s %12s\n",
+                "layout", "pattern", "accesses", "L1 misses", "miss rate", "ns/cell");
+
+    Layout layouts[] = { Layout("plain", n, 0, ncomp, false),
+                         Layout("padded", n, pad, ncomp, false),
+                         Layout("interleaved", n, 0, ncomp, true) };
+
+    const int reps = 20;
+    const double cells = double(n)*n*n;
+    double sink = 0;
+    for (Layout& q : layouts) {
+        {
+            Cache c(l1_kb, l1_ways);
+            sink += gather(q, n, qfs, nspec, c);
+            NoCache nc;
+            const double t = seconds([&]{ sink += gather(q, n, qfs, nspec, nc); }, reps);
+            std::printf("%-12s %-7s %12llu %12llu %9.2f%% %12.2f\n", q.name, "gather",
+                        (unsigned long long)c.accesses, (unsigned long long)c.misses,
+                        100.0*c.misses/c.accesses, 1.e9*t/cells);
+        }
+        {
+            Cache c(l1_kb, l1_ways);
+            sink += pencil(q, n, c);
+            NoCache nc;
+            const double t = seconds([&]{ sink += pencil(q, n, nc); }, reps);
+            std::printf("%-12s %-7s %12llu %12llu %9.2f%% %12.2f\n", q.name, "pencil",
+                        (unsigned long long)c.accesses, (unsigned long long)c.misses,
+                        100.0*c.misses/c.accesses, 1.e9*t/cells);
+        }
+    }
+    return sink == 0.123 ? 1 : 0;
+}
@@ -0,0 +1,144 @@
+!
+! Microbenchmark for the sparse LU of the DVODE Newton matrix
+! (Util/VODE/dvsparse.f90, pelec.chem_integrator = 3) against the dense
+! DGEFA/DGESL it replaces, over mechanism sizes.
+!
+! The Jacobian structure is that of a synthetic mechanism of nspec species
+! and 5*nspec reactions of 2 to 4 species each, most of them involving the
+! small radical pool (the first 8 species), one in ten a third-body reaction
+! (its species' rates then depend on every concentration), plus a full temperature
+! row and column -- the structure chem_jacobian_pattern finds for a real
+! mechanism.  P = I - h J is diagonally dominant, so the sparse factors pass
+! the pivot test and are checked against the pivoted dense ones; the last
+! columns zero the first pivot of P, which must send dvspfa to its DGEFA
+! fallback (fallback T), and check that solution too.
+!
+! Build and run (from this directory):
+!   gfortran -O3 -march=native -o vode_sparse_lu ../VODE/dvsparse.f90 \
+!       vode_sparse_lu.f90 ../VODE/dgefa.f ../VODE/dgesl.f \
+!       ../BLAS/daxpy.f ../BLAS/ddot.f ../BLAS/dscal.f ../BLAS/idamax.f
+!   ./vode_sparse_lu
+!
+! On one x86-64 core, the sparse LU runs at 0.7-0.8x the dense one at 53
+! species, 0.9-1.1x at 116, 1.0x at 250 and 1.3-1.6x at 500.  The
+! third-body rows leave J 60-70% dense below a few hundred species.
+!
+
+program vode_sparse_lu
+
+  use vode_sparse_module, only : vode_sparse_init, sp_dense, piv
+
+  implicit none
+
+  integer, parameter :: sizes(6) = (/ 9, 21, 53, 116, 250, 500 /)
+  integer, parameter :: npool = 8
+
+  integer :: s, nspec, n, nrep, rep, r, m, a, b, info, nnz_pattern, nnz_lu
+  integer :: species(4)
+  integer, allocatable :: ipvt(:)
+  logical, allocatable :: pattern(:,:)
+  logical :: third_body
+  double precision, allocatable :: p(:,:), lu(:,:), x(:), xd(:), rhs(:)
+  double precision :: t0, t1, t_dense, t_sparse, err, err_fb
+  integer(8) :: seed
+
+  seed = 12345
+
+  write(*,'(a6,a10,a10,a12,a12,a9,a10,a6,a10)') 'nspec', 'nnz(J)', 'nnz(LU)', &
+       'dense us', 'sparse us', 'speedup', 'max err', 'fb', 'fb err'
+
+  do s = 1, size(sizes)
+
+     nspec = sizes(s)
+     n     = nspec + 1
+
+     allocate(pattern(n,n), p(n,n), lu(n,n), x(n), xd(n), rhs(n), ipvt(n))
+
+     ! Synthetic mechanism structure
+     pattern = .false.
+     pattern(n,:) = .true.
+     pattern(:,n) = .true.
+     do r = 1, 5*nspec
+        m = 2 + int(3*rand01())
+        do a = 1, m
+           if (rand01() .lt. 0.6d0) then
+              species(a) = 1 + int(min(npool,nspec)*rand01())
+           else
+              species(a) = 1 + int(nspec*rand01())
+           end if
+        end do
+        third_body = rand01() .lt. 0.1d0
+        do a = 1, m
+           if (third_body) pattern(species(a),1:nspec) = .true.
+           do b = 1, m
+              pattern(species(a),species(b)) = .true.
+           end do
+        end do
+     end do
+
+     call vode_sparse_init(n, pattern, nnz_pattern, nnz_lu)
+
+     ! P = I - h J over the pattern, diagonally dominant
+     p = 0.d0
+     do b = 1, n
+        do a = 1, n
+           if (pattern(a,b)) p(a,b) = -(rand01() - 0.5d0)
+        end do
+        p(b,b) = 1.d0 + sum(abs(p(:,b)))
+     end do
+     do a = 1, n
+        rhs(a) = rand01()
+     end do
+
+     nrep = max(10, 20000000 / (n*n*n + 1000))
+
+     call cpu_time(t0)
+     do rep = 1, nrep
+        lu = p
+        call dgefa(lu, n, n, ipvt, info)
+        xd = rhs
+        call dgesl(lu, n, n, ipvt, xd, 0)
+     end do
+     call cpu_time(t1)
+     t_dense = (t1 - t0) / nrep
+
+     call cpu_time(t0)
+     do rep = 1, nrep
+        lu = p
+        call dvspfa(lu, n, n, ipvt, info)
+        x = rhs
+        call dvspsl(lu, n, n, ipvt, x)
+     end do
+     call cpu_time(t1)
+     t_sparse = (t1 - t0) / nrep
+
+     err = maxval(abs(x - xd)) / maxval(abs(xd))
+
+     ! Same system with a vanishing pivot: dvspfa must fall back to DGEFA
+     lu = p
+     lu(piv(1),piv(1)) = 0.d0
+     call dgefa(lu, n, n, ipvt, info)
+     xd = rhs
+     call dgesl(lu, n, n, ipvt, xd, 0)
+     lu = p
+     lu(piv(1),piv(1)) = 0.d0
+     call dvspfa(lu, n, n, ipvt, info)
+     x = rhs
+     call dvspsl(lu, n, n, ipvt, x)
+     err_fb = maxval(abs(x - xd)) / maxval(abs(xd))
+
+     write(*,'(i6,i10,i10,f12.2,f12.2,f9.1,es10.2,l6,es10.2)') nspec, nnz_pattern, nnz_lu, &
+          1.d6*t_dense, 1.d6*t_sparse, t_dense/t_sparse, err, sp_dense, err_fb
+
+     deallocate(pattern, p, lu, x, xd, rhs, ipvt)
+
+  end do
+
+contains
+
+  double precision function rand01()
+    seed = modulo(seed * 16807_8, 2147483647_8)
+    rand01 = dble(seed) / 2147483647.d0
+  end function rand01
+
+end program vode_sparse_lu